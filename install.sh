@@ -25,7 +25,7 @@ if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
             # python2.7 is preinstalled on macOS
             # check, for each programme individually with brew, whether it is already installed
             # due to brew issues on MacOS after system upgrade
-            for formula in boost cmake pkg-config parallel; do
+            for formula in boost cmake google-benchmark pkg-config parallel; do
                 # if brew formula is installed
                 if brew ls --versions $formula > /dev/null; then
                     continue
@@ -54,7 +54,7 @@ if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
             echo "Installing dependencies (this may take a while)..."
             if sudo apt-get update >/dev/null; then
                 boostall=$(apt-cache search --names-only '^libboost1.[0-9]+-all-dev$' | sort | tail -n 1 | cut -f1 -d' ')
-                sudo apt-get install --no-install-recommends -y clang-6.0 libclang-6.0-dev clang-format-6.0 gcovr python2.7 gcc-7 llvm llvm-6.0-tools build-essential cmake parallel $boostall &
+                sudo apt-get install --no-install-recommends -y clang-6.0 libclang-6.0-dev clang-format-6.0 gcovr python2.7 gcc-7 llvm llvm-6.0-tools build-essential cmake libbenchmark-dev parallel $boostall &
 
                 if ! git submodule update --jobs 5 --init --recursive; then
                     echo "Error during installation."
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+
+"""Compares two benchmark result files, e.g., of hyriseBenchmarkTPCH before and after a change.
+
+Usage: ./scripts/compare_benchmarks.py <old result> <new result> [options]
+
+The results are expected in the format of scripts/benchmark_result_schema.json. The JSON output of Google Benchmark
+(hyriseMicroBenchmarks) is accepted as well; run it with --benchmark_repetitions=<n> to get more than one duration per
+benchmark.
+
+For every benchmark that occurs in both files, the speed-up is the ratio of the old to the new median duration, i.e.,
+values above 1 mean that the new version is faster. Its confidence interval is estimated by bootstrapping: the runs of
+both versions are resampled with replacement and the speed-up of the resampled medians is computed many times. The
+difference is statistically significant if the Mann-Whitney U test rejects that both versions have the same
+distribution of durations. A significant slowdown of more than --threshold is reported as a regression, and the exit
+code is 1 if there is any, so that the script can gate changes. Only the Python 3 standard library is needed.
+"""
+
+import argparse
+import json
+import math
+import os
+import random
+import statistics
+import sys
+
+SCHEMA_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "benchmark_result_schema.json")
+
+TIME_UNITS_IN_NS = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def validate(value, schema, path="$"):
+    """Returns the violations of the subset of JSON Schema that benchmark_result_schema.json uses."""
+    types = {"object": dict, "array": list, "string": str, "boolean": bool, "number": (int, float), "integer": int}
+    expected_type = schema.get("type")
+    if expected_type:
+        is_boolean = isinstance(value, bool)
+        if not isinstance(value, types[expected_type]) or (is_boolean and expected_type != "boolean"):
+            return [f"{path} is not of type {expected_type}"]
+
+    errors = []
+    if "enum" in schema and value not in schema["enum"]:
+        errors.append(f"{path} is not one of {schema['enum']}")
+    if "minimum" in schema and value < schema["minimum"]:
+        errors.append(f"{path} is less than {schema['minimum']}")
+    if "exclusiveMinimum" in schema and value <= schema["exclusiveMinimum"]:
+        errors.append(f"{path} is not greater than {schema['exclusiveMinimum']}")
+    if "minItems" in schema and len(value) < schema["minItems"]:
+        errors.append(f"{path} has fewer than {schema['minItems']} items")
+    for key in schema.get("required", []):
+        if key not in value:
+            errors.append(f"{path} misses the property {key}")
+    for key, property_schema in schema.get("properties", {}).items():
+        if key in value:
+            errors += validate(value[key], property_schema, f"{path}.{key}")
+    if "items" in schema:
+        for index, item in enumerate(value):
+            errors += validate(item, schema["items"], f"{path}[{index}]")
+    return errors
+
+
+def load_results(file_name, schema):
+    """Returns the context and, by benchmark name, the durations (in ns) and row count (None if unknown)."""
+    with open(file_name) as file:
+        result = json.load(file)
+
+    # Google Benchmark: every repetition is an entry of its own, aggregates (mean, median, ...) are skipped
+    if isinstance(result, dict) and "benchmarks" in result:
+        benchmarks = {}
+        for benchmark in result["benchmarks"]:
+            if benchmark.get("run_type", "iteration") != "iteration":
+                continue
+            name = benchmark.get("run_name", benchmark["name"])
+            duration = benchmark["real_time"] * TIME_UNITS_IN_NS[benchmark.get("time_unit", "ns")]
+            benchmarks.setdefault(name, {"durations": [], "row_count": None})["durations"].append(duration)
+        return result.get("context", {}), benchmarks
+
+    errors = validate(result, schema)
+    if errors:
+        sys.exit(f"{file_name} does not match {SCHEMA_FILE}:\n  " + "\n  ".join(errors))
+    benchmarks = {query["name"]: {"durations": query["durations_ns"], "row_count": query.get("row_count")}
+                  for query in result["queries"]}
+    return result["context"], benchmarks
+
+
+def bootstrap_speedup_interval(old, new, confidence, resamples, random_generator):
+    """Returns the confidence interval of the speed-up of the medians by bootstrapping."""
+    speedups = sorted(statistics.median(random_generator.choices(old, k=len(old))) /
+                      statistics.median(random_generator.choices(new, k=len(new))) for _ in range(resamples))
+    alpha = (1.0 - confidence) / 2.0
+    return speedups[int(alpha * (resamples - 1))], speedups[int(math.ceil((1.0 - alpha) * (resamples - 1)))]
+
+
+def mann_whitney_u_p_value(old, new):
+    """Returns the two-sided p-value of the Mann-Whitney U test, using the normal approximation with tie correction."""
+    values = sorted([(value, 0) for value in old] + [(value, 1) for value in new])
+    ranks = [0.0] * len(values)
+    tie_correction = 0.0
+    begin = 0
+    while begin < len(values):
+        end = begin
+        while end + 1 < len(values) and values[end + 1][0] == values[begin][0]:
+            end += 1
+        for index in range(begin, end + 1):
+            ranks[index] = (begin + end) / 2.0 + 1.0
+        tie_count = end - begin + 1
+        tie_correction += tie_count ** 3 - tie_count
+        begin = end + 1
+
+    old_count, new_count = len(old), len(new)
+    count = old_count + new_count
+    old_rank_sum = sum(rank for rank, (_, sample) in zip(ranks, values) if sample == 0)
+    u = old_rank_sum - old_count * (old_count + 1) / 2.0
+    mean = old_count * new_count / 2.0
+    variance = old_count * new_count / 12.0 * ((count + 1) - tie_correction / (count * (count - 1)))
+    if variance <= 0.0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2.0)))
+
+
+def format_duration(duration_ns):
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if duration_ns >= factor:
+            return f"{duration_ns / factor:.2f} {unit}"
+    return f"{duration_ns:.0f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("old", help="result file of the baseline")
+    parser.add_argument("new", help="result file of the version to compare")
+    parser.add_argument("--confidence", type=float, default=0.95, help="level of the confidence intervals")
+    parser.add_argument("--alpha", type=float, default=0.05, help="significance level of the Mann-Whitney U test")
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="minimum relative slowdown that counts as a regression (default 0.05, i.e., 5%%)")
+    parser.add_argument("--resamples", type=int, default=10000, help="number of bootstrap resamples")
+    parser.add_argument("--seed", type=int, default=42, help="seed of the bootstrapping, for reproducible intervals")
+    arguments = parser.parse_args()
+
+    with open(SCHEMA_FILE) as file:
+        schema = json.load(file)
+    old_context, old_benchmarks = load_results(arguments.old, schema)
+    new_context, new_benchmarks = load_results(arguments.new, schema)
+
+    for key in sorted(set(old_context) | set(new_context)):
+        if key in ("date", "host_name", "executable", "load_avg") or old_context.get(key) == new_context.get(key):
+            continue
+        print(f"Warning: the contexts differ in {key}: {old_context.get(key)} vs. {new_context.get(key)}")
+
+    names = [name for name in old_benchmarks if name in new_benchmarks]
+    for name in sorted((set(old_benchmarks) ^ set(new_benchmarks))):
+        print(f"Warning: {name} only occurs in {'the old' if name in old_benchmarks else 'the new'} results")
+
+    random_generator = random.Random(arguments.seed)
+    header = ("Benchmark", "Old median", "New median", "Speed-up", f"{arguments.confidence:.0%} CI", "p-value", "")
+    rows = []
+    speedups = []
+    regressions = []
+    for name in names:
+        old = old_benchmarks[name]["durations"]
+        new = new_benchmarks[name]["durations"]
+        old_median, new_median = statistics.median(old), statistics.median(new)
+        speedup = old_median / new_median if new_median > 0 else math.inf
+        if 0.0 < speedup < math.inf:
+            speedups.append(speedup)
+
+        status = ""
+        interval = "n/a"
+        p_value = "n/a"
+        if len(old) < 2 or len(new) < 2:
+            status = "too few runs"
+        else:
+            low, high = bootstrap_speedup_interval(old, new, arguments.confidence, arguments.resamples,
+                                                   random_generator)
+            interval = f"[{low:.2f}, {high:.2f}]"
+            p = mann_whitney_u_p_value(old, new)
+            p_value = f"{p:.4f}"
+            significant = p < arguments.alpha and not low <= 1.0 <= high
+            if significant and speedup < 1.0 / (1.0 + arguments.threshold):
+                status = "REGRESSION"
+                regressions.append(name)
+            elif significant and speedup > 1.0 + arguments.threshold:
+                status = "improvement"
+
+        old_row_count, new_row_count = old_benchmarks[name]["row_count"], new_benchmarks[name]["row_count"]
+        if old_row_count is not None and new_row_count is not None and old_row_count != new_row_count:
+            status = (status + ", " if status else "") + f"RESULT CHANGED ({old_row_count} -> {new_row_count} rows)"
+            regressions.append(name)
+
+        rows.append((name, format_duration(old_median), format_duration(new_median), f"{speedup:.2f}x", interval,
+                     p_value, status))
+
+    widths = [max(len(row[column]) for row in [header] + rows) for column in range(len(header))]
+    for row in [header] + rows:
+        cells = [row[0].ljust(widths[0])] + [cell.rjust(width) for cell, width in zip(row[1:-1], widths[1:-1])]
+        print("  ".join(cells + [row[-1]]).rstrip())
+
+    if speedups:
+        geometric_mean = math.exp(statistics.fmean(math.log(speedup) for speedup in speedups))
+        print(f"\nGeometric mean of the speed-ups: {geometric_mean:.2f}x")
+    if regressions:
+        print(f"{len(set(regressions))} of {len(rows)} benchmarks regressed: {', '.join(sorted(set(regressions)))}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
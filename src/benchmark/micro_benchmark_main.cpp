@@ -0,0 +1,46 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "scheduler/worker_pool.hpp"
+#include "utils/hardware_counters.hpp"
+
+// Runs the micro benchmarks like the main function of Google Benchmark, but writes the results to
+// hyriseMicroBenchmarks.json as well unless --benchmark_out is given, so that they can be tracked over time. With
+// --hardware_counters, the cycles, instructions, and misses per iteration are reported as well (Linux only).
+int main(int argc, char** argv) {
+  auto arguments = std::vector<char*>{};
+  auto has_output_file = false;
+  auto hardware_counters = false;
+  for (const auto argument : std::vector<char*>(argv, argv + argc)) {
+    if (std::strcmp(argument, "--hardware_counters") == 0) {
+      hardware_counters = true;
+      continue;
+    }
+    if (std::strncmp(argument, "--benchmark_out=", std::strlen("--benchmark_out=")) == 0) has_output_file = true;
+    arguments.emplace_back(argument);
+  }
+
+  if (hardware_counters && !opossum::HardwareCounters::enable()) {
+    std::cerr << "Hardware counters are not available, see /proc/sys/kernel/perf_event_paranoid" << std::endl;
+  }
+
+  auto output_file_argument = std::string{"--benchmark_out=hyriseMicroBenchmarks.json"};
+  auto output_format_argument = std::string{"--benchmark_out_format=json"};
+  if (!has_output_file) {
+    arguments.emplace_back(output_file_argument.data());
+    arguments.emplace_back(output_format_argument.data());
+  }
+
+  // the operators run on the calling thread, so that the results measure their work rather than the scheduling
+  opossum::WorkerPool::get().set_worker_count(0);
+
+  auto argument_count = static_cast<int>(arguments.size());
+  benchmark::Initialize(&argument_count, arguments.data());
+  if (benchmark::ReportUnrecognizedArguments(argument_count, arguments.data())) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
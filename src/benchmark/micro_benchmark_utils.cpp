@@ -0,0 +1,141 @@
+#include "micro_benchmark_utils.hpp"
+
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<Table> make_value_table(const std::string& data_type) {
+  auto table = std::make_shared<Table>(MICRO_BENCHMARK_CHUNK_SIZE);
+  table->add_column_definition("a", data_type);
+
+  // the same values for every data type
+  auto random_engine = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{0, 999};
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    for (auto chunk_begin = uint32_t{0}; chunk_begin < MICRO_BENCHMARK_ROW_COUNT;
+         chunk_begin += MICRO_BENCHMARK_CHUNK_SIZE) {
+      auto values = std::vector<Type>{};
+      values.reserve(MICRO_BENCHMARK_CHUNK_SIZE);
+      for (auto row = uint32_t{0}; row < MICRO_BENCHMARK_CHUNK_SIZE; ++row) {
+        values.emplace_back(type_cast<Type>(micro_benchmark_value(data_type, distribution(random_engine))));
+      }
+
+      auto chunk = std::make_shared<Chunk>();
+      chunk->add_segment(std::make_shared<ValueSegment<Type>>(std::move(values)));
+      table->emplace_chunk(chunk);
+    }
+  });
+  return table;
+}
+
+}  // namespace
+
+const std::vector<std::string>& micro_benchmark_data_types() {
+  static const auto data_types = std::vector<std::string>{"int", "long", "float", "double", "string"};
+  return data_types;
+}
+
+std::string segment_kind_name(const SegmentKind segment_kind) {
+  switch (segment_kind) {
+    case SegmentKind::Value:
+      return "value";
+    case SegmentKind::Dictionary:
+      return "dictionary";
+    case SegmentKind::Reference:
+      return "reference";
+  }
+  Fail("Unknown segment kind");
+  return "";
+}
+
+std::shared_ptr<const Table> make_micro_benchmark_table(const std::string& data_type, const SegmentKind segment_kind) {
+  static auto tables = std::map<std::pair<std::string, SegmentKind>, std::shared_ptr<const Table>>{};
+  static auto mutex = std::mutex{};
+  auto lock = std::lock_guard(mutex);
+
+  auto& table = tables[{data_type, segment_kind}];
+  if (table) return table;
+
+  auto value_table = make_value_table(data_type);
+  if (segment_kind == SegmentKind::Dictionary) {
+    // all chunks but the last are compressed, the last one is full, so add an empty chunk behind it
+    value_table->create_new_chunk();
+    for (auto chunk_id = ChunkID{0}; chunk_id + 1 < value_table->chunk_count(); ++chunk_id) {
+      value_table->compress_chunk(chunk_id);
+    }
+  }
+
+  if (segment_kind == SegmentKind::Reference) {
+    auto table_wrapper = std::make_shared<TableWrapper>(value_table);
+    table_wrapper->execute();
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals,
+                                            micro_benchmark_value(data_type, 0));
+    scan->execute();
+    table = scan->get_output();
+  } else {
+    table = value_table;
+  }
+  return table;
+}
+
+AllTypeVariant micro_benchmark_value(const std::string& data_type, const int32_t value) {
+  if (data_type == "string") {
+    auto stream = std::stringstream{};
+    stream << std::setw(4) << std::setfill('0') << value;
+    return stream.str();
+  }
+
+  auto result = AllTypeVariant{};
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    result = type_cast<Type>(AllTypeVariant{value});
+  });
+  return result;
+}
+
+MicroBenchmarkHardwareCounters::MicroBenchmarkHardwareCounters(benchmark::State& state)
+    : _state(state),
+      _begin_readings(HardwareCounters::is_enabled() ? std::optional{HardwareCounters::read_thread_counters()}
+                                                     : std::nullopt) {}
+
+MicroBenchmarkHardwareCounters::~MicroBenchmarkHardwareCounters() {
+  if (!_begin_readings) return;
+
+  auto readings = HardwareCounters::read_thread_counters();
+  for (auto counter = size_t{0}; counter < readings.counts.size(); ++counter) {
+    const auto begin_count = _begin_readings->counts[counter];
+    readings.counts[counter] = readings.counts[counter] > begin_count ? readings.counts[counter] - begin_count : 0;
+  }
+  const auto values = HardwareCounterValues::from_readings(readings);
+
+  for (const auto& [name, count] : {std::pair{"cycles", values.cycles}, std::pair{"instructions", values.instructions},
+                                    std::pair{"llc_misses", values.last_level_cache_misses},
+                                    std::pair{"branch_misses", values.branch_misses}}) {
+    if (count) {
+      _state.counters[name] = benchmark::Counter(static_cast<double>(*count), benchmark::Counter::kAvgIterations);
+    }
+  }
+  if (const auto ipc = values.instructions_per_cycle()) _state.counters["IPC"] = *ipc;
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class Table;
+
+// The data types of the micro benchmarks, indexed by the data type argument of a benchmark
+const std::vector<std::string>& micro_benchmark_data_types();
+
+enum class SegmentKind { Value, Dictionary, Reference };
+
+// returns the name of the segment kind for the labels of benchmarks, e.g., "dictionary"
+std::string segment_kind_name(const SegmentKind segment_kind);
+
+// Number of rows and chunk size of the tables created by make_micro_benchmark_table
+constexpr auto MICRO_BENCHMARK_ROW_COUNT = uint32_t{1'000'000};
+constexpr auto MICRO_BENCHMARK_CHUNK_SIZE = uint32_t{100'000};
+
+// Returns a table with a single column "a" of the given data type and values that are uniformly distributed in
+// [0, 1000), so that OpLessThan with (a conversion of) x selects x per mille of the rows. Strings are zero-padded to
+// four digits to keep their order. Reference tables are the output of a TableScan that selects all rows.
+// Tables are created once and shared between benchmarks.
+std::shared_ptr<const Table> make_micro_benchmark_table(const std::string& data_type, const SegmentKind segment_kind);
+
+// returns the value of the given data type that corresponds to the integer value of make_micro_benchmark_table
+AllTypeVariant micro_benchmark_value(const std::string& data_type, const int32_t value);
+
+// Reports the hardware counters of the calling thread during its lifetime as counters of the benchmark, e.g., "cycles"
+// per iteration, if HardwareCounters are enabled (see --hardware_counters). It is created right before the benchmark
+// loop. The micro benchmarks run without workers, so the calling thread does all the work.
+class MicroBenchmarkHardwareCounters : private Noncopyable {
+ public:
+  explicit MicroBenchmarkHardwareCounters(benchmark::State& state);
+  ~MicroBenchmarkHardwareCounters();
+
+ protected:
+  benchmark::State& _state;
+  const std::optional<HardwareCounterReadings> _begin_readings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Arguments: data type index, segment kind, selectivity in percent
+static void BM_TableScan(benchmark::State& state) {
+  const auto& data_type = micro_benchmark_data_types()[state.range(0)];
+  const auto segment_kind = static_cast<SegmentKind>(state.range(1));
+  const auto selectivity = static_cast<int32_t>(state.range(2));
+
+  const auto table = make_micro_benchmark_table(data_type, segment_kind);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto search_value = micro_benchmark_value(data_type, selectivity * 10);
+
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, search_value);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table->row_count()));
+  state.SetLabel(data_type + "/" + segment_kind_name(segment_kind) + "/" + std::to_string(selectivity) + "%");
+}
+
+static void table_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (auto data_type_index = 0; data_type_index < static_cast<int>(micro_benchmark_data_types().size());
+       ++data_type_index) {
+    for (const auto segment_kind : {SegmentKind::Value, SegmentKind::Dictionary, SegmentKind::Reference}) {
+      for (const auto selectivity : {1, 10, 50, 100}) {
+        benchmark->Args({data_type_index, static_cast<int>(segment_kind), selectivity});
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_TableScan)->Apply(table_scan_arguments)->Unit(benchmark::kMicrosecond);
+
+}  // namespace opossum
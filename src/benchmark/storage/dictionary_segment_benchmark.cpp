@@ -0,0 +1,55 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+// Arguments: data type index, number of distinct values
+static void BM_DictionarySegmentConstruction(benchmark::State& state) {
+  const auto& data_type = micro_benchmark_data_types()[state.range(0)];
+  const auto distinct_count = static_cast<int32_t>(state.range(1));
+
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    auto random_engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int32_t>{0, distinct_count - 1};
+    auto values = std::vector<Type>{};
+    for (auto row = uint32_t{0}; row < MICRO_BENCHMARK_CHUNK_SIZE; ++row) {
+      values.emplace_back(type_cast<Type>(micro_benchmark_value(data_type, distribution(random_engine))));
+    }
+    const auto value_segment = std::make_shared<ValueSegment<Type>>(std::move(values));
+
+    MicroBenchmarkHardwareCounters hardware_counters{state};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(std::make_shared<DictionarySegment<Type>>(value_segment));
+    }
+  });
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * MICRO_BENCHMARK_CHUNK_SIZE));
+  state.SetLabel(data_type + "/" + std::to_string(distinct_count) + " distinct");
+}
+
+static void dictionary_segment_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (auto data_type_index = 0; data_type_index < static_cast<int>(micro_benchmark_data_types().size());
+       ++data_type_index) {
+    // at most 10,000 distinct values, as the values of micro_benchmark_value have four digits
+    for (const auto distinct_count : {10, 1'000, 10'000}) {
+      benchmark->Args({data_type_index, distinct_count});
+    }
+  }
+}
+
+BENCHMARK(BM_DictionarySegmentConstruction)->Apply(dictionary_segment_arguments)->Unit(benchmark::kMicrosecond);
+
+}  // namespace opossum
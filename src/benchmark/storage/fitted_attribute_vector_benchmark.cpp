@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns an attribute vector of the given width (in bytes) with random value ids
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(const int64_t width) {
+  const auto size = MICRO_BENCHMARK_CHUNK_SIZE;
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+  if (width == 1) attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(size, uint8_t{255});
+  if (width == 2) attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(size, uint16_t{65'535});
+  if (width == 4) attribute_vector = std::make_shared<FittedAttributeVector<uint32_t>>(size, uint32_t{1'000'000});
+
+  auto random_engine = std::mt19937{42};
+  for (auto offset = size_t{0}; offset < size; ++offset) {
+    attribute_vector->set(offset, ValueID{static_cast<uint32_t>(random_engine() % 255)});
+  }
+  return attribute_vector;
+}
+
+}  // namespace
+
+// Arguments: width of the value ids in bytes. Reads every value id through the virtual get.
+static void BM_FittedAttributeVectorGet(benchmark::State& state) {
+  const auto attribute_vector = make_attribute_vector(state.range(0));
+
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (auto offset = size_t{0}; offset < attribute_vector->size(); ++offset) sum += attribute_vector->get(offset);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * attribute_vector->size()));
+}
+
+// Arguments: width of the value ids in bytes. Reads every value id from the vector of the resolved width.
+static void BM_FittedAttributeVectorResolvedValues(benchmark::State& state) {
+  const auto attribute_vector = make_attribute_vector(state.range(0));
+
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    resolve_attribute_vector_width(*attribute_vector, [&](const auto& value_ids) {
+      sum = std::accumulate(value_ids.cbegin(), value_ids.cend(), uint64_t{0});
+    });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * attribute_vector->size()));
+}
+
+// Arguments: width of the value ids in bytes. Reads the value ids in a random order through the virtual get.
+static void BM_FittedAttributeVectorRandomGet(benchmark::State& state) {
+  const auto attribute_vector = make_attribute_vector(state.range(0));
+  auto offsets = std::vector<size_t>(attribute_vector->size());
+  std::iota(offsets.begin(), offsets.end(), size_t{0});
+  std::shuffle(offsets.begin(), offsets.end(), std::mt19937{42});
+
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (const auto offset : offsets) sum += attribute_vector->get(offset);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * attribute_vector->size()));
+}
+
+BENCHMARK(BM_FittedAttributeVectorGet)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FittedAttributeVectorResolvedValues)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FittedAttributeVectorRandomGet)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMicrosecond);
+
+}  // namespace opossum
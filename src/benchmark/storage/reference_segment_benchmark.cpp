@@ -0,0 +1,52 @@
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+// Arguments: data type index, kind of the referenced segments. Accesses every row of the first chunk of a reference
+// table with operator[], which resolves the referenced segment per row.
+static void BM_ReferenceSegmentAccess(benchmark::State& state) {
+  const auto& data_type = micro_benchmark_data_types()[state.range(0)];
+  const auto referenced_segment_kind = static_cast<SegmentKind>(state.range(1));
+
+  // the segment references all rows of the first chunk of a value or dictionary table
+  const auto referenced_table = make_micro_benchmark_table(data_type, referenced_segment_kind);
+  const auto table = std::make_shared<Table>(MICRO_BENCHMARK_CHUNK_SIZE);
+  const auto positions = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < MICRO_BENCHMARK_CHUNK_SIZE; ++chunk_offset) {
+    positions->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  const auto segment = ReferenceSegment{referenced_table, ColumnID{0}, positions};
+
+  PerformanceWarningDisabler performance_warning_disabler;
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    for (auto offset = size_t{0}; offset < segment.size(); ++offset) {
+      benchmark::DoNotOptimize(segment[offset]);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segment.size()));
+  state.SetLabel(data_type + "/" + segment_kind_name(referenced_segment_kind));
+}
+
+static void reference_segment_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (auto data_type_index = 0; data_type_index < static_cast<int>(micro_benchmark_data_types().size());
+       ++data_type_index) {
+    for (const auto segment_kind : {SegmentKind::Value, SegmentKind::Dictionary}) {
+      benchmark->Args({data_type_index, static_cast<int>(segment_kind)});
+    }
+  }
+}
+
+BENCHMARK(BM_ReferenceSegmentAccess)->Apply(reference_segment_arguments)->Unit(benchmark::kMicrosecond);
+
+}  // namespace opossum
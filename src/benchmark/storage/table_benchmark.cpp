@@ -0,0 +1,35 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Arguments: chunk size. Every iteration appends 100,000 rows of an int and a string column to a new table.
+static void BM_TableAppend(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  constexpr auto row_count = 100'000;
+
+  // the rows are prepared upfront, so that only append is measured
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (auto row = 0; row < row_count; ++row) rows.push_back({row, "value" + std::to_string(row % 1'000)});
+
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    auto table = Table{chunk_size};
+    table.add_column("a", "int");
+    table.add_column("b", "string");
+    for (const auto& row : rows) table.append(row);
+    benchmark::DoNotOptimize(table.row_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+
+BENCHMARK(BM_TableAppend)->Arg(1'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,343 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "utils/hardware_counters.hpp"
+#include "utils/performance_warning.hpp"
+
+// Runs the TPC-H queries of TpchQueries on generated data (see TpchTableGenerator), so it needs neither data files
+// nor network access. Every query is executed a number of unmeasured warmup runs first, then the measured runs.
+// The latencies are reported as percentiles per query, on the console and, if requested, as JSON, so that the results
+// of two builds can be compared. Use a release build for meaningful results. The PerformanceWarnings that the measured
+// runs of a query hit are reported with its results; with --strict, the first one aborts the benchmark. With
+// --hardware_counters, the hardware counters of the operators of the measured runs are reported as well.
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct BenchmarkConfig {
+  float scale_factor = 0.1f;
+  uint32_t chunk_size = 100'000;
+  bool dictionary_encoding = false;
+  size_t warmup_runs = 1;
+  size_t runs = 10;
+  std::vector<size_t> query_ids = TpchQueries::query_ids();
+  ExecutionMode execution_mode = ExecutionMode::OperatorAtATime;
+  bool runtime_filters = true;
+  size_t worker_count = WorkerPool::get().worker_count();
+  std::string output_file;
+  bool strict = false;
+  bool hardware_counters = false;
+};
+
+// the measured runs of a query
+struct QueryResult {
+  size_t query_id;
+  uint64_t row_count;
+  std::vector<uint64_t> durations_ns;
+  PerformanceWarningCounts performance_warnings;
+  // of the operators, per measured run, missing if HardwareCounters are not enabled
+  HardwareCounterValues hardware_counters;
+};
+
+void print_usage() {
+  std::cout << "Usage: hyriseBenchmarkTPCH [options]\n"
+               "  --scale=<factor>     scale factor of the generated data (default 0.1)\n"
+               "  --chunk_size=<rows>  maximum number of rows per chunk (default 100000)\n"
+               "  --dictionary         dictionary-encode all chunks but the last of every table\n"
+               "  --warmup=<runs>      unmeasured runs per query (default 1)\n"
+               "  --runs=<runs>        measured runs per query (default 10)\n"
+               "  --queries=<ids>      comma-separated queries, e.g., 1,6 (default: all supported)\n"
+               "  --mode=<mode>        execution mode, operator (default) or pipelined\n"
+               "  --no_runtime_filters do not drop rows without join partners in scans (see TpchQueries)\n"
+               "  --workers=<count>    number of worker threads (default: number of hardware threads)\n"
+               "  --output=<file>      also write the results as JSON to the file\n"
+               "  --strict             fail if a query hits a performance warning\n"
+               "  --hardware_counters  report the cycles, instructions, and misses of the queries (Linux only)\n"
+               "  --help               print this message\n";
+}
+
+// returns the configuration given by the arguments, or nothing (after printing the usage) if they are invalid
+std::optional<BenchmarkConfig> parse_arguments(const int argc, char** argv) {
+  auto config = BenchmarkConfig{};
+  for (auto argument_id = 1; argument_id < argc; ++argument_id) {
+    const auto argument = std::string{argv[argument_id]};
+    const auto separator = argument.find('=');
+    const auto name = argument.substr(0, separator);
+    const auto value = separator == std::string::npos ? std::string{} : argument.substr(separator + 1);
+
+    if (name == "--help") {
+      print_usage();
+      return std::nullopt;
+    }
+
+    try {
+      if (name == "--scale") {
+        config.scale_factor = std::stof(value);
+      } else if (name == "--chunk_size") {
+        config.chunk_size = static_cast<uint32_t>(std::stoul(value));
+      } else if (name == "--dictionary") {
+        config.dictionary_encoding = true;
+      } else if (name == "--warmup") {
+        config.warmup_runs = std::stoul(value);
+      } else if (name == "--runs") {
+        config.runs = std::stoul(value);
+      } else if (name == "--queries") {
+        config.query_ids.clear();
+        auto stream = std::stringstream{value};
+        for (auto query_id = std::string{}; std::getline(stream, query_id, ',');) {
+          config.query_ids.emplace_back(std::stoul(query_id));
+        }
+      } else if (name == "--mode" && (value == "operator" || value == "pipelined")) {
+        config.execution_mode = value == "operator" ? ExecutionMode::OperatorAtATime : ExecutionMode::Pipelined;
+      } else if (name == "--no_runtime_filters") {
+        config.runtime_filters = false;
+      } else if (name == "--workers") {
+        config.worker_count = std::stoul(value);
+      } else if (name == "--output" && !value.empty()) {
+        config.output_file = value;
+      } else if (name == "--strict") {
+        config.strict = true;
+      } else if (name == "--hardware_counters") {
+        config.hardware_counters = true;
+      } else {
+        throw std::invalid_argument(argument);
+      }
+    } catch (const std::logic_error&) {
+      std::cerr << "Invalid argument: " << argument << "\n";
+      print_usage();
+      return std::nullopt;
+    }
+  }
+
+  const auto& supported_query_ids = TpchQueries::query_ids();
+  for (const auto query_id : config.query_ids) {
+    if (std::find(supported_query_ids.cbegin(), supported_query_ids.cend(), query_id) == supported_query_ids.cend()) {
+      std::cerr << "TPC-H query " << query_id << " is not supported\n";
+      return std::nullopt;
+    }
+  }
+  if (config.scale_factor <= 0.0f || config.chunk_size == 0 || config.runs == 0) {
+    print_usage();
+    return std::nullopt;
+  }
+  return config;
+}
+
+// the nearest-rank percentile of the sorted durations
+uint64_t percentile(const std::vector<uint64_t>& sorted_durations, const double percent) {
+  const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted_durations.size()));
+  return sorted_durations[std::max(rank, size_t{1}) - 1];
+}
+
+const auto PERCENTILES = std::vector<std::pair<std::string, double>>{
+    {"min", 0.0}, {"median", 50.0}, {"p90", 90.0}, {"p95", 95.0}, {"p99", 99.0}, {"max", 100.0}};
+
+// Returns the hardware counters of all operators of the plan. Operators that were fused into a pipeline are skipped,
+// as their counters are part of those of the last operator of the pipeline, which is the one that has an output.
+HardwareCounterValues plan_hardware_counters(const std::shared_ptr<const AbstractOperator>& root) {
+  auto hardware_counters = std::optional<HardwareCounterValues>{};
+  auto visited_operators = std::set<const AbstractOperator*>{};
+  auto pending_operators = std::vector<std::shared_ptr<const AbstractOperator>>{root};
+  while (!pending_operators.empty()) {
+    const auto op = pending_operators.back();
+    pending_operators.pop_back();
+    if (!op || !visited_operators.emplace(op.get()).second) continue;
+
+    if (op->executed()) {
+      if (hardware_counters) {
+        *hardware_counters += op->performance_data().hardware_counters;
+      } else {
+        hardware_counters = op->performance_data().hardware_counters;
+      }
+    }
+    pending_operators.emplace_back(op->input_left());
+    pending_operators.emplace_back(op->input_right());
+  }
+  return hardware_counters.value_or(HardwareCounterValues{});
+}
+
+QueryResult run_query(const BenchmarkConfig& config, const size_t query_id) {
+  auto result = QueryResult{query_id, 0, {}, {}, {}};
+  auto previous_warning_counts = PerformanceWarningCounts{};
+  for (auto run = size_t{0}; run < config.warmup_runs + config.runs; ++run) {
+    if (run == config.warmup_runs) previous_warning_counts = PerformanceWarnings::counts();
+    const auto plan = TpchQueries::build_plan(query_id, config.runtime_filters);
+    const auto begin = std::chrono::steady_clock::now();
+    Scheduler::execute(plan, config.execution_mode);
+    const auto duration = std::chrono::steady_clock::now() - begin;
+
+    result.row_count = plan->get_output()->row_count();
+    if (run >= config.warmup_runs) {
+      result.durations_ns.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+
+      const auto hardware_counters = plan_hardware_counters(plan);
+      if (run == config.warmup_runs) {
+        result.hardware_counters = hardware_counters;
+      } else {
+        result.hardware_counters += hardware_counters;
+      }
+    }
+  }
+  for (auto counter : {&result.hardware_counters.cycles, &result.hardware_counters.instructions,
+                       &result.hardware_counters.last_level_cache_misses, &result.hardware_counters.branch_misses}) {
+    if (*counter) **counter /= config.runs;
+  }
+  result.performance_warnings = PerformanceWarnings::counts_since(previous_warning_counts);
+  return result;
+}
+
+void print_result(const QueryResult& result) {
+  auto sorted_durations = result.durations_ns;
+  std::sort(sorted_durations.begin(), sorted_durations.end());
+
+  std::cout << "Q" << std::left << std::setw(3) << result.query_id << std::right << std::fixed
+            << std::setprecision(2);
+  for (const auto& [name, percent] : PERCENTILES) {
+    std::cout << "  " << name << " " << std::setw(9) << percentile(sorted_durations, percent) / 1e6 << " ms";
+  }
+  std::cout << "  (" << result.row_count << " rows)" << std::endl;
+  const auto hardware_counters = result.hardware_counters.to_string(0);
+  if (!hardware_counters.empty()) std::cout << "  Hardware counters per run: " << hardware_counters << "\n";
+
+  if (!result.performance_warnings.empty()) {
+    std::cout << "  Performance warnings of the measured runs:\n";
+    PerformanceWarnings::print(result.performance_warnings);
+  }
+}
+
+void write_json(const BenchmarkConfig& config, const std::vector<QueryResult>& results, std::ostream& out) {
+  out << "{\n";
+  out << "  \"context\": {\n";
+  out << "    \"benchmark\": \"TPC-H\",\n";
+  out << "    \"scale_factor\": " << config.scale_factor << ",\n";
+  out << "    \"chunk_size\": " << config.chunk_size << ",\n";
+  out << "    \"dictionary_encoding\": " << (config.dictionary_encoding ? "true" : "false") << ",\n";
+  out << "    \"execution_mode\": \""
+      << (config.execution_mode == ExecutionMode::OperatorAtATime ? "operator" : "pipelined") << "\",\n";
+  out << "    \"runtime_filters\": " << (config.runtime_filters ? "true" : "false") << ",\n";
+  out << "    \"worker_count\": " << config.worker_count << ",\n";
+  out << "    \"warmup_runs\": " << config.warmup_runs << ",\n";
+  out << "    \"runs\": " << config.runs << "\n";
+  out << "  },\n";
+  out << "  \"queries\": [";
+  for (auto result_id = size_t{0}; result_id < results.size(); ++result_id) {
+    const auto& result = results[result_id];
+    auto sorted_durations = result.durations_ns;
+    std::sort(sorted_durations.begin(), sorted_durations.end());
+
+    out << (result_id == 0 ? "\n" : ",\n") << "    {\n";
+    out << "      \"name\": \"TPC-H " << std::setw(2) << std::setfill('0') << result.query_id << std::setfill(' ')
+        << "\",\n";
+    out << "      \"query_id\": " << result.query_id << ",\n";
+    out << "      \"row_count\": " << result.row_count << ",\n";
+    for (const auto& [name, percent] : PERCENTILES) {
+      out << "      \"" << name << "_ns\": " << percentile(sorted_durations, percent) << ",\n";
+    }
+    const auto sum = std::accumulate(sorted_durations.cbegin(), sorted_durations.cend(), uint64_t{0});
+    out << "      \"mean_ns\": " << sum / sorted_durations.size() << ",\n";
+    const auto& hardware_counters = result.hardware_counters;
+    auto counters = std::vector<std::pair<std::string, uint64_t>>{};
+    for (const auto& [name, count] : {std::pair{"cycles", hardware_counters.cycles},
+                                      std::pair{"instructions", hardware_counters.instructions},
+                                      std::pair{"last_level_cache_misses", hardware_counters.last_level_cache_misses},
+                                      std::pair{"branch_misses", hardware_counters.branch_misses}}) {
+      if (count) counters.emplace_back(name, *count);
+    }
+    if (!counters.empty()) {
+      out << "      \"hardware_counters\": {";
+      for (auto counter_id = size_t{0}; counter_id < counters.size(); ++counter_id) {
+        const auto& [name, count] = counters[counter_id];
+        out << (counter_id == 0 ? "" : ", ") << "\"" << name << "\": " << count;
+      }
+      out << "},\n";
+    }
+    if (!result.performance_warnings.empty()) {
+      out << "      \"performance_warnings\": {";
+      for (auto iterator = result.performance_warnings.cbegin(); iterator != result.performance_warnings.cend();
+           ++iterator) {
+        out << (iterator == result.performance_warnings.cbegin() ? "" : ", ") << "\"" << iterator->first
+            << "\": " << iterator->second;
+      }
+      out << "},\n";
+    }
+    out << "      \"durations_ns\": [";
+    for (auto run = size_t{0}; run < result.durations_ns.size(); ++run) {
+      out << (run == 0 ? "" : ", ") << result.durations_ns[run];
+    }
+    out << "]\n    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto config = parse_arguments(argc, argv);
+  if (!config) return 1;
+
+  WorkerPool::get().set_worker_count(config->worker_count);
+
+  std::cout << "Generating TPC-H data with scale factor " << config->scale_factor << " and chunk size "
+            << config->chunk_size << "..." << std::flush;
+  const auto generation_begin = std::chrono::steady_clock::now();
+  TpchTableGenerator{config->scale_factor, config->chunk_size}.generate_and_store();
+  if (config->dictionary_encoding) {
+    for (const auto& table_name : StorageManager::get().table_names()) {
+      const auto table = StorageManager::get().get_table(table_name);
+      for (auto chunk_id = ChunkID{0}; chunk_id + 1 < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+  }
+  const auto generation_duration = std::chrono::steady_clock::now() - generation_begin;
+  std::cout << " done in " << std::chrono::duration_cast<std::chrono::milliseconds>(generation_duration).count()
+            << " ms" << std::endl;
+
+  std::cout << "Running " << config->query_ids.size() << " queries with " << config->warmup_runs << " warmup and "
+            << config->runs << " measured runs each on " << config->worker_count << " workers" << std::endl;
+  if (config->hardware_counters && !HardwareCounters::enable()) {
+    std::cout << "Hardware counters are not available, see /proc/sys/kernel/perf_event_paranoid" << std::endl;
+  }
+
+  // the data generation may use slow paths, only the queries should not
+  PerformanceWarnings::set_strict(config->strict);
+  auto results = std::vector<QueryResult>{};
+  for (const auto query_id : config->query_ids) {
+    try {
+      results.emplace_back(run_query(*config, query_id));
+    } catch (const std::logic_error& error) {
+      std::cerr << "\nTPC-H query " << query_id << " failed: " << error.what() << std::endl;
+      return 1;
+    }
+    print_result(results.back());
+  }
+
+  if (!config->output_file.empty()) {
+    auto output_file = std::ofstream{config->output_file};
+    write_json(*config, results, output_file);
+    std::cout << "Results written to " << config->output_file << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,60 @@
+#include <stdlib.h>  // NOLINT
+#include <unistd.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// a temporary .tbl file with the given number of rows of an int, a float, and a string column
+class TableFile : private Noncopyable {
+ public:
+  explicit TableFile(const int64_t row_count) {
+    auto path = std::string{"/tmp/hyrise_load_table_benchmark_XXXXXX"};
+    const auto file_descriptor = mkstemp(path.data());
+    Assert(file_descriptor >= 0, "Could not create a temporary file");
+    close(file_descriptor);
+    _path = path;
+
+    auto file = std::ofstream{_path};
+    file << "a|b|c\nint|float|string\n";
+    for (auto row = int64_t{0}; row < row_count; ++row) {
+      file << row << "|" << row * 0.5 << "|value" << row % 1'000 << "\n";
+    }
+  }
+
+  ~TableFile() { unlink(_path.c_str()); }
+
+  const std::string& path() const { return _path; }
+
+ protected:
+  std::string _path;
+};
+
+}  // namespace
+
+// Arguments: number of rows
+static void BM_LoadTable(benchmark::State& state) {
+  const auto table_file = TableFile{state.range(0)};
+
+  MicroBenchmarkHardwareCounters hardware_counters{state};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(load_table(table_file.path(), 10'000));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+
+BENCHMARK(BM_LoadTable)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#include "abstract_expression.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractExpression::AbstractExpression(const ExpressionType type,
+                                       std::vector<std::shared_ptr<const AbstractExpression>> arguments)
+    : _type(type), _arguments(std::move(arguments)) {
+  for (const auto& argument : _arguments) {
+    Assert(argument, "Expression arguments must not be null");
+  }
+}
+
+ExpressionType AbstractExpression::type() const { return _type; }
+
+const std::vector<std::shared_ptr<const AbstractExpression>>& AbstractExpression::arguments() const {
+  return _arguments;
+}
+
+std::string AbstractExpression::_argument_description(const AbstractExpression& argument, const Table& table) const {
+  const auto description = argument.description(table);
+  if (argument.arguments().empty()) return description;
+  return "(" + description + ")";
+}
+
+std::string common_data_type(const std::string& lhs, const std::string& rhs) {
+  if (lhs == "string" || rhs == "string") {
+    Assert(lhs == rhs, "Strings cannot be combined with numbers");
+    return lhs;
+  }
+
+  static const auto numeric_types = std::vector<std::string>{"int", "long", "float", "double"};
+  const auto lhs_rank = std::find(numeric_types.cbegin(), numeric_types.cend(), lhs);
+  const auto rhs_rank = std::find(numeric_types.cbegin(), numeric_types.cend(), rhs);
+  Assert(lhs_rank != numeric_types.cend() && rhs_rank != numeric_types.cend(), "Unknown data type");
+  return *std::max(lhs_rank, rhs_rank);
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ExpressionType { Column, Value, Arithmetic, Comparison };
+
+// Expressions form a tree that computes a value for every row of a table, e.g., a * (b + 1). They are immutable, so
+// subtrees can be shared. Use the functions in expression_functional.hpp to build them and the ExpressionEvaluator to
+// evaluate them.
+class AbstractExpression : private Noncopyable {
+ public:
+  explicit AbstractExpression(const ExpressionType type,
+                              std::vector<std::shared_ptr<const AbstractExpression>> arguments = {});
+  virtual ~AbstractExpression() = default;
+
+  ExpressionType type() const;
+  const std::vector<std::shared_ptr<const AbstractExpression>>& arguments() const;
+
+  // returns the type of the values of the expression when it is evaluated on the given table, e.g., "int"
+  virtual std::string data_type(const Table& table) const = 0;
+
+  // returns a readable representation of the expression, e.g., "a * (b + 1)", which is used as column name
+  virtual std::string description(const Table& table) const = 0;
+
+ protected:
+  // returns the description of an argument, in parentheses if it consists of multiple parts
+  std::string _argument_description(const AbstractExpression& argument, const Table& table) const;
+
+  const ExpressionType _type;
+  const std::vector<std::shared_ptr<const AbstractExpression>> _arguments;
+};
+
+// Returns the type that two expressions are evaluated in if they are combined, i.e., the wider of two numeric types
+// (int < long < float < double). Strings can only be combined with strings.
+std::string common_data_type(const std::string& lhs, const std::string& rhs);
+
+}  // namespace opossum
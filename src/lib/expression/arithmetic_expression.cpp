@@ -0,0 +1,48 @@
+#include "arithmetic_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ArithmeticExpression::ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                                           const std::shared_ptr<const AbstractExpression>& left_operand,
+                                           const std::shared_ptr<const AbstractExpression>& right_operand)
+    : AbstractExpression(ExpressionType::Arithmetic, {left_operand, right_operand}),
+      _arithmetic_operator(arithmetic_operator) {}
+
+ArithmeticOperator ArithmeticExpression::arithmetic_operator() const { return _arithmetic_operator; }
+
+const std::shared_ptr<const AbstractExpression>& ArithmeticExpression::left_operand() const { return _arguments[0]; }
+
+const std::shared_ptr<const AbstractExpression>& ArithmeticExpression::right_operand() const { return _arguments[1]; }
+
+std::string ArithmeticExpression::data_type(const Table& table) const {
+  const auto data_type = common_data_type(left_operand()->data_type(table), right_operand()->data_type(table));
+  Assert(data_type != "string", "Arithmetic expressions need numeric operands");
+  return data_type;
+}
+
+std::string ArithmeticExpression::description(const Table& table) const {
+  auto operator_string = std::string{};
+  switch (_arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      operator_string = " + ";
+      break;
+    case ArithmeticOperator::Subtraction:
+      operator_string = " - ";
+      break;
+    case ArithmeticOperator::Multiplication:
+      operator_string = " * ";
+      break;
+    case ArithmeticOperator::Division:
+      operator_string = " / ";
+      break;
+  }
+  return _argument_description(*left_operand(), table) + operator_string +
+         _argument_description(*right_operand(), table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division };
+
+// Combines two numeric expressions. Both are evaluated in their common type (see common_data_type), which is also
+// the type of the result. As in SQL, integers are divided without remainder.
+class ArithmeticExpression : public AbstractExpression {
+ public:
+  ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                       const std::shared_ptr<const AbstractExpression>& left_operand,
+                       const std::shared_ptr<const AbstractExpression>& right_operand);
+
+  ArithmeticOperator arithmetic_operator() const;
+  const std::shared_ptr<const AbstractExpression>& left_operand() const;
+  const std::shared_ptr<const AbstractExpression>& right_operand() const;
+
+  std::string data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const ArithmeticOperator _arithmetic_operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// Returns the values of a column of the table
+class ColumnExpression : public AbstractExpression {
+ public:
+  explicit ColumnExpression(const ColumnID column_id);
+
+  ColumnID column_id() const;
+
+  std::string data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+}  // namespace opossum
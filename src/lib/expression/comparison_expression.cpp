@@ -0,0 +1,55 @@
+#include "comparison_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ComparisonExpression::ComparisonExpression(const ScanType scan_type,
+                                           const std::shared_ptr<const AbstractExpression>& left_operand,
+                                           const std::shared_ptr<const AbstractExpression>& right_operand)
+    : AbstractExpression(ExpressionType::Comparison, {left_operand, right_operand}), _scan_type(scan_type) {}
+
+ScanType ComparisonExpression::scan_type() const { return _scan_type; }
+
+const std::shared_ptr<const AbstractExpression>& ComparisonExpression::left_operand() const { return _arguments[0]; }
+
+const std::shared_ptr<const AbstractExpression>& ComparisonExpression::right_operand() const { return _arguments[1]; }
+
+std::string ComparisonExpression::data_type(const Table& table) const {
+  // checks that the operands can be compared
+  common_data_type(left_operand()->data_type(table), right_operand()->data_type(table));
+  return "int";
+}
+
+std::string ComparisonExpression::description(const Table& table) const {
+  auto operator_string = std::string{};
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      operator_string = " = ";
+      break;
+    case ScanType::OpNotEquals:
+      operator_string = " != ";
+      break;
+    case ScanType::OpLessThan:
+      operator_string = " < ";
+      break;
+    case ScanType::OpLessThanEquals:
+      operator_string = " <= ";
+      break;
+    case ScanType::OpGreaterThan:
+      operator_string = " > ";
+      break;
+    case ScanType::OpGreaterThanEquals:
+      operator_string = " >= ";
+      break;
+    default:
+      Fail("Unknown scan operator");
+  }
+  return _argument_description(*left_operand(), table) + operator_string +
+         _argument_description(*right_operand(), table);
+}
+
+}  // namespace opossum
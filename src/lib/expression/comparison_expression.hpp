@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// Compares two expressions, which are evaluated in their common type (see common_data_type). As there is no boolean
+// type, the result is an int that is 1 if the comparison holds and 0 otherwise.
+class ComparisonExpression : public AbstractExpression {
+ public:
+  ComparisonExpression(const ScanType scan_type, const std::shared_ptr<const AbstractExpression>& left_operand,
+                       const std::shared_ptr<const AbstractExpression>& right_operand);
+
+  ScanType scan_type() const;
+  const std::shared_ptr<const AbstractExpression>& left_operand() const;
+  const std::shared_ptr<const AbstractExpression>& right_operand() const;
+
+  std::string data_type(const Table& table) const override;
+  std::string description(const Table& table) const override;
+
+ protected:
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
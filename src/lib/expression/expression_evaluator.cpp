@@ -0,0 +1,177 @@
+#include "expression_evaluator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arithmetic_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "resolve_type.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/with_comparator.hpp"
+#include "value_expression.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Applies functor to the values of both operands row by row. There is a separate loop for each combination of
+// literals and non-literals, so that every loop only accesses vectors and can be vectorized.
+template <typename Result, typename Left, typename Right, typename Functor>
+ExpressionResult<Result> apply_binary(const ExpressionResult<Left>& lhs, const ExpressionResult<Right>& rhs,
+                                      const Functor& functor) {
+  auto result = ExpressionResult<Result>{};
+  if (lhs.is_literal && rhs.is_literal) {
+    result.values.emplace_back(functor(lhs.values.front(), rhs.values.front()));
+    result.is_literal = true;
+    return result;
+  }
+
+  const auto row_count = lhs.is_literal ? rhs.values.size() : lhs.values.size();
+  DebugAssert(lhs.is_literal || rhs.is_literal || lhs.values.size() == rhs.values.size(), "Operand sizes differ");
+  result.values.resize(row_count);
+  auto* const result_values = result.values.data();
+
+  if (lhs.is_literal) {
+    const auto lhs_value = lhs.values.front();
+    const auto* const rhs_values = rhs.values.data();
+    for (auto row = size_t{0}; row < row_count; ++row) result_values[row] = functor(lhs_value, rhs_values[row]);
+  } else if (rhs.is_literal) {
+    const auto* const lhs_values = lhs.values.data();
+    const auto rhs_value = rhs.values.front();
+    for (auto row = size_t{0}; row < row_count; ++row) result_values[row] = functor(lhs_values[row], rhs_value);
+  } else {
+    const auto* const lhs_values = lhs.values.data();
+    const auto* const rhs_values = rhs.values.data();
+    for (auto row = size_t{0}; row < row_count; ++row) result_values[row] = functor(lhs_values[row], rhs_values[row]);
+  }
+
+  return result;
+}
+
+}  // namespace
+
+ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id)
+    : _table(table), _chunk(table->get_chunk(chunk_id)) {}
+
+std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_to_segment(const AbstractExpression& expression) const {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(expression.data_type(*_table), [&](auto type) {
+    using T = typename decltype(type)::type;
+    auto result = _evaluate_typed<T>(expression);
+    if (result.is_literal) {
+      const auto value = result.values.front();
+      result.values.assign(_chunk.size(), value);
+    }
+    segment = std::make_shared<ValueSegment<T>>(std::move(result.values));
+  });
+  return segment;
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate(const AbstractExpression& expression) const {
+  auto result = ExpressionResult<T>{};
+  resolve_data_type(expression.data_type(*_table), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ExpressionDataType, T>) {
+      result = _evaluate_typed<T>(expression);
+    } else if constexpr (std::is_arithmetic_v<ExpressionDataType> && std::is_arithmetic_v<T>) {  // NOLINT
+      const auto expression_result = _evaluate_typed<ExpressionDataType>(expression);
+      result.values.resize(expression_result.values.size());
+      std::transform(expression_result.values.cbegin(), expression_result.values.cend(), result.values.begin(),
+                     [](const ExpressionDataType value) { return static_cast<T>(value); });
+      result.is_literal = expression_result.is_literal;
+    } else {
+      Fail("Strings cannot be converted to numbers and vice versa");
+    }
+  });
+  return result;
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate_typed(const AbstractExpression& expression) const {
+  switch (expression.type()) {
+    case ExpressionType::Column: {
+      const auto& segment = *_chunk.get_segment(static_cast<const ColumnExpression&>(expression).column_id());
+      auto result = ExpressionResult<T>{};
+      result.values.resize(segment.size());
+      resolve_segment_values<T>(segment,
+                                [&](const size_t position, const T& value) { result.values[position] = value; });
+      return result;
+    }
+
+    case ExpressionType::Value:
+      return ExpressionResult<T>{{type_cast<T>(static_cast<const ValueExpression&>(expression).value())}, true};
+
+    case ExpressionType::Arithmetic:
+      if constexpr (std::is_arithmetic_v<T>) {
+        return _evaluate_arithmetic<T>(expression);
+      }
+      break;
+
+    case ExpressionType::Comparison:
+      if constexpr (std::is_same_v<T, int32_t>) {
+        return _evaluate_comparison(expression);
+      }
+      break;
+  }
+
+  Fail("Expression does not have the requested type");
+  return {};
+}
+
+template <typename T>
+ExpressionResult<T> ExpressionEvaluator::_evaluate_arithmetic(const AbstractExpression& expression) const {
+  const auto& arithmetic_expression = static_cast<const ArithmeticExpression&>(expression);
+  const auto lhs = _evaluate<T>(*arithmetic_expression.left_operand());
+  const auto rhs = _evaluate<T>(*arithmetic_expression.right_operand());
+
+  switch (arithmetic_expression.arithmetic_operator()) {
+    case ArithmeticOperator::Addition:
+      return apply_binary<T>(lhs, rhs, std::plus<T>{});
+    case ArithmeticOperator::Subtraction:
+      return apply_binary<T>(lhs, rhs, std::minus<T>{});
+    case ArithmeticOperator::Multiplication:
+      return apply_binary<T>(lhs, rhs, std::multiplies<T>{});
+    case ArithmeticOperator::Division:
+      if constexpr (std::is_integral_v<T>) {
+        Assert(std::find(rhs.values.cbegin(), rhs.values.cend(), T{0}) == rhs.values.cend(), "Division by zero");
+      }
+      return apply_binary<T>(lhs, rhs, std::divides<T>{});
+  }
+
+  Fail("Unknown arithmetic operator");
+  return {};
+}
+
+ExpressionResult<int32_t> ExpressionEvaluator::_evaluate_comparison(const AbstractExpression& expression) const {
+  const auto& comparison_expression = static_cast<const ComparisonExpression&>(expression);
+  const auto& left_operand = *comparison_expression.left_operand();
+  const auto& right_operand = *comparison_expression.right_operand();
+
+  // compare the operands in their common type
+  auto result = ExpressionResult<int32_t>{};
+  resolve_data_type(common_data_type(left_operand.data_type(*_table), right_operand.data_type(*_table)),
+                    [&](auto type) {
+                      using T = typename decltype(type)::type;
+                      const auto lhs = _evaluate<T>(left_operand);
+                      const auto rhs = _evaluate<T>(right_operand);
+                      with_comparator(comparison_expression.scan_type(), [&](auto comparator) {
+                        result = apply_binary<int32_t>(lhs, rhs, [&](const T& lhs_value, const T& rhs_value) {
+                          return static_cast<int32_t>(comparator(lhs_value, rhs_value));
+                        });
+                      });
+                    });
+  return result;
+}
+
+}  // namespace opossum
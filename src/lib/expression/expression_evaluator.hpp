@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+class Table;
+
+// The values of an expression for all rows of a chunk. A literal has a single value that applies to every row.
+template <typename T>
+struct ExpressionResult {
+  std::vector<T> values;
+  bool is_literal = false;
+};
+
+// Evaluates expressions on a chunk of a table column-at-a-time: every node of the expression tree is evaluated for
+// all rows at once into a typed vector, so the operations run in tight loops that the compiler can vectorize. The
+// values of columns are materialized once per node, literals are not materialized at all.
+//
+// Example:
+//   const auto evaluator = ExpressionEvaluator{table, ChunkID{0}};
+//   const auto segment = evaluator.evaluate_to_segment(*mul_(column_(ColumnID{0}), 2));
+class ExpressionEvaluator {
+ public:
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id);
+
+  // returns a ValueSegment with the values of the expression for all rows of the chunk
+  std::shared_ptr<BaseSegment> evaluate_to_segment(const AbstractExpression& expression) const;
+
+ protected:
+  // returns the values of the expression converted to T, which needs to be the type of the expression if that is not
+  // numeric
+  template <typename T>
+  ExpressionResult<T> _evaluate(const AbstractExpression& expression) const;
+
+  // returns the values of an expression whose data type is T
+  template <typename T>
+  ExpressionResult<T> _evaluate_typed(const AbstractExpression& expression) const;
+
+  template <typename T>
+  ExpressionResult<T> _evaluate_arithmetic(const AbstractExpression& expression) const;
+
+  ExpressionResult<int32_t> _evaluate_comparison(const AbstractExpression& expression) const;
+
+  const std::shared_ptr<const Table> _table;
+  const Chunk& _chunk;
+};
+
+}  // namespace opossum
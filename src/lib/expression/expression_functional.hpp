@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "arithmetic_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "value_expression.hpp"
+
+/**
+ * Shorthands to build expression trees. The trailing underscores avoid clashes with other names.
+ *
+ * Example (price * (1 - discount) > 100):
+ *   using namespace opossum::expression_functional;  // NOLINT
+ *   const auto expression = greater_than_(mul_(column_(ColumnID{0}), sub_(value_(1.0), column_(ColumnID{1}))), 100);
+ */
+
+namespace opossum::expression_functional {
+
+using ExpressionPointer = std::shared_ptr<const AbstractExpression>;
+
+inline ExpressionPointer column_(const ColumnID column_id) { return std::make_shared<ColumnExpression>(column_id); }
+
+inline ExpressionPointer value_(const AllTypeVariant& value) { return std::make_shared<ValueExpression>(value); }
+
+// operands can be given as expressions or as values
+inline ExpressionPointer to_expression(const ExpressionPointer& expression) { return expression; }
+inline ExpressionPointer to_expression(const AllTypeVariant& value) { return value_(value); }
+
+#define DEFINE_BINARY_EXPRESSION(name, ExpressionClass, expression_operator)                                   \
+  template <typename Left, typename Right>                                                                    \
+  ExpressionPointer name(const Left& left_operand, const Right& right_operand) {                              \
+    return std::make_shared<ExpressionClass>(expression_operator, to_expression(left_operand),                \
+                                             to_expression(right_operand));                                   \
+  }
+
+DEFINE_BINARY_EXPRESSION(add_, ArithmeticExpression, ArithmeticOperator::Addition)
+DEFINE_BINARY_EXPRESSION(sub_, ArithmeticExpression, ArithmeticOperator::Subtraction)
+DEFINE_BINARY_EXPRESSION(mul_, ArithmeticExpression, ArithmeticOperator::Multiplication)
+DEFINE_BINARY_EXPRESSION(div_, ArithmeticExpression, ArithmeticOperator::Division)
+DEFINE_BINARY_EXPRESSION(equals_, ComparisonExpression, ScanType::OpEquals)
+DEFINE_BINARY_EXPRESSION(not_equals_, ComparisonExpression, ScanType::OpNotEquals)
+DEFINE_BINARY_EXPRESSION(less_than_, ComparisonExpression, ScanType::OpLessThan)
+DEFINE_BINARY_EXPRESSION(less_than_equals_, ComparisonExpression, ScanType::OpLessThanEquals)
+DEFINE_BINARY_EXPRESSION(greater_than_, ComparisonExpression, ScanType::OpGreaterThan)
+DEFINE_BINARY_EXPRESSION(greater_than_equals_, ComparisonExpression, ScanType::OpGreaterThanEquals)
+
+#undef DEFINE_BINARY_EXPRESSION
+
+}  // namespace opossum::expression_functional
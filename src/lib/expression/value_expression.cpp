@@ -0,0 +1,31 @@
+#include "value_expression.hpp"
+
+#include <boost/hana/for_each.hpp>
+
+#include <string>
+
+#include "type_cast.hpp"
+
+namespace opossum {
+
+ValueExpression::ValueExpression(const AllTypeVariant& value)
+    : AbstractExpression(ExpressionType::Value), _value(value) {}
+
+const AllTypeVariant& ValueExpression::value() const { return _value; }
+
+std::string ValueExpression::data_type(const Table& table) const {
+  // the data types are listed in the same order as the types of the variant
+  auto data_type = std::string{};
+  auto type_index = 0;
+  hana::for_each(data_types, [&](auto data_type_pair) {
+    if (type_index++ == _value.which()) data_type = hana::first(data_type_pair);
+  });
+  return data_type;
+}
+
+std::string ValueExpression::description(const Table& table) const {
+  if (data_type(table) == "string") return "'" + type_cast<std::string>(_value) + "'";
+  return type_cast<std::string>(_value);
+}
+
+}  // namespace opossum
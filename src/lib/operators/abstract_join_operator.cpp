@@ -0,0 +1,81 @@
+#include "abstract_join_operator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                                           const std::shared_ptr<const AbstractOperator> right,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator(left, right), _column_ids(column_ids), _scan_type(scan_type) {
+  Assert(left && right, "Joins need two inputs");
+}
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+std::shared_ptr<Table> AbstractJoinOperator::_initialize_output_table() const {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto output_table = std::make_shared<Table>(std::max(left_table->chunk_size(), right_table->chunk_size()));
+  for (auto column_id = ColumnID{0}; column_id < left_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+
+  // the left input may already contain suffixed names, e.g., if it is the output of a join itself
+  const auto& output_column_names = output_table->column_names();
+  for (auto column_id = ColumnID{0}; column_id < right_table->column_count(); ++column_id) {
+    auto column_name = right_table->column_name(column_id);
+    while (std::find(output_column_names.cbegin(), output_column_names.cend(), column_name) !=
+           output_column_names.cend()) {
+      column_name += "_right";
+    }
+    output_table->add_column_definition(column_name, right_table->column_type(column_id));
+  }
+
+  return output_table;
+}
+
+std::vector<std::shared_ptr<Chunk>> AbstractJoinOperator::_make_output_chunks(
+    const ReferenceSegmentWriter& left_writer, const ReferenceSegmentWriter& right_writer,
+    const std::shared_ptr<const PosList>& left_positions, const std::shared_ptr<const PosList>& right_positions,
+    const uint32_t chunk_size) {
+  DebugAssert(left_positions->size() == right_positions->size(), "Join produced unmatched positions");
+  DebugAssert(chunk_size > 0, "Output chunks need to hold at least one row");
+
+  const auto make_chunk = [&](const std::shared_ptr<const PosList>& left, const std::shared_ptr<const PosList>& right) {
+    auto chunk = std::make_shared<Chunk>();
+    left_writer.write(*chunk, left);
+    right_writer.write(*chunk, right);
+    return chunk;
+  };
+
+  // positions that fit into a single chunk are not copied
+  if (left_positions->size() <= chunk_size) return {make_chunk(left_positions, right_positions)};
+
+  // a slice of positions that reference a single chunk still references that chunk only
+  const auto slice = [](const PosList& positions, const size_t begin, const size_t end) {
+    auto sliced_positions = std::make_shared<PosList>(positions.cbegin() + begin, positions.cbegin() + end);
+    if (positions.references_single_chunk()) sliced_positions->guarantee_single_chunk();
+    return sliced_positions;
+  };
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto chunk_begin = size_t{0}; chunk_begin < left_positions->size(); chunk_begin += chunk_size) {
+    const auto chunk_end = std::min(left_positions->size(), chunk_begin + chunk_size);
+    chunks.emplace_back(
+        make_chunk(slice(*left_positions, chunk_begin, chunk_end), slice(*right_positions, chunk_begin, chunk_end)));
+  }
+  return chunks;
+}
+
+}  // namespace opossum
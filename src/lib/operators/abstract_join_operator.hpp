@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractJoinOperator is the super class of all join operators. A join combines the rows of its left and its right
+// input for which the predicate "left[column_ids.first] scan_type right[column_ids.second]" holds.
+//
+// The output consists of all columns of the left input followed by all columns of the right input. Its segments are
+// ReferenceSegments that point into the tables of both inputs (or the tables those reference).
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                       const std::shared_ptr<const AbstractOperator> right,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+
+ protected:
+  // Creates an empty table with the column definitions of the output and the larger chunk size of both inputs. Columns
+  // of the right input whose name already exists in the output are suffixed with "_right" until it is unique.
+  std::shared_ptr<Table> _initialize_output_table() const;
+
+  // Creates the output chunks that reference the rows of both inputs given by the pairs of positions. The positions
+  // are split into chunks of at most chunk_size rows, at least one (possibly empty) chunk is created. This can be
+  // called concurrently.
+  static std::vector<std::shared_ptr<Chunk>> _make_output_chunks(const ReferenceSegmentWriter& left_writer,
+                                                                 const ReferenceSegmentWriter& right_writer,
+                                                                 const std::shared_ptr<const PosList>& left_positions,
+                                                                 const std::shared_ptr<const PosList>& right_positions,
+                                                                 const uint32_t chunk_size);
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
@@ -1,12 +1,17 @@
 #include "abstract_operator.hpp"
 
 #include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "scheduler/cpu_time_account.hpp"
+#include "scheduler/worker_pool.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracer.hpp"
 
 namespace opossum {
 
@@ -14,19 +19,93 @@ AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>
                                    const std::shared_ptr<const AbstractOperator> right)
     : _input_left(left), _input_right(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  auto input_tables = std::vector<std::shared_ptr<const Table>>{};
+  if (_input_left) input_tables.emplace_back(_input_table_left());
+  if (_input_right) input_tables.emplace_back(_input_table_right());
+  _execute_and_record([&]() { return _on_execute(); }, input_tables);
+}
+
+std::shared_future<void> AbstractOperator::execute_async(const ExecutionMode mode) {
+  Assert(!_output && !_async_execution, "Operators shall not be executed twice");
+  auto self = weak_from_this().lock();
+  Assert(self, "Operators that are executed asynchronously need to be owned by a shared_ptr");
+
+  // The task is stored before it is queued, so that get_output always waits for it. The task owns the operator, so
+  // that it is not destroyed while the task is queued or running.
+  _async_execution = std::make_shared<ScheduledTask>([self, mode]() { Scheduler::execute(*self, mode); });
+  WorkerPool::get().schedule(_async_execution);
+
+  return _async_execution->future();
+}
+
+bool AbstractOperator::executed() const {
+  // the output is written by the thread that executes the operator, which the ready future synchronizes with
+  if (_async_execution && _async_execution->future().wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+    return false;
+  }
+  return _output != nullptr;
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
-  // TODO(anyone): You should place some meaningful checks here
+  if (_async_execution) {
+    WorkerPool::get().wait(*_async_execution);
+    _async_execution->future().get();
+  }
+  Assert(_output, "Operator has not been executed");
   return _output;
 }
 
+const PerformanceData& AbstractOperator::performance_data() const {
+  if (_async_execution) WorkerPool::get().wait(*_async_execution);
+  return _performance_data;
+}
+
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
 
+bool AbstractOperator::is_pipelineable() const { return false; }
+
+std::shared_ptr<Table> AbstractOperator::initialize_output_table(const std::shared_ptr<const Table>& input_table) {
+  Fail("Operator cannot be pipelined");
+  return nullptr;
+}
+
+std::shared_ptr<Chunk> AbstractOperator::process_morsel(const std::shared_ptr<const Table>& input_table,
+                                                        const ChunkID chunk_id) const {
+  Fail("Operator cannot be pipelined");
+  return nullptr;
+}
+
 std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
 
+void AbstractOperator::_execute_and_record(const std::function<std::shared_ptr<const Table>()>& execute_function,
+                                           const std::vector<std::shared_ptr<const Table>>& input_tables) {
+  const auto trace_scope = Tracer::Scope{"operator", Tracer::is_enabled() ? Tracer::intern(name()) : ""};
+
+  // the tasks that the operator spawns charge the same account, see WorkerPool
+  auto cpu_time_account = CpuTimeAccount{};
+  const auto begin = std::chrono::steady_clock::now();
+  {
+    const auto cpu_time_scope = CpuTimeAccount::Scope{&cpu_time_account};
+    _output = execute_function();
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  _performance_data.walltime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+  _performance_data.cpu_time = cpu_time_account.cpu_time();
+  _performance_data.hardware_counters = cpu_time_account.hardware_counters();
+  for (const auto& input_table : input_tables) {
+    _performance_data.input_row_count += input_table->row_count();
+    _performance_data.input_chunk_count += input_table->chunk_count();
+  }
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  _performance_data.output_bytes = _output->estimate_memory_usage();
+  _performance_data.executed = true;
+}
+
 }  // namespace opossum
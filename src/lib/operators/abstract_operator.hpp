@@ -1,13 +1,19 @@
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "performance_data.hpp"
+#include "scheduler/scheduler.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class Chunk;
+class ScheduledTask;
 class Table;
 
 // AbstractOperator is the abstract super class for all operators.
@@ -15,16 +21,18 @@ class Table;
 // Their lifecycle has three phases:
 // 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
 // call get_output in their execute method
-// 2. The execute method is called from the outside (usually by the scheduler). This is where the heavy lifting is done.
+// 2. The execute method is called from the outside (usually by the Scheduler). This is where the heavy lifting is done.
 // By now, the input operators have already executed.
-// 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
-// succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
+// 3. The consumer (usually another operator) calls get_output. This should be very cheap. It fails if the operator
+// has not been executed, and waits for the operator if it is executed asynchronously (see execute_async).
+//
+// Operators that are executed asynchronously need to be owned by a shared_ptr, which the execution keeps alive.
 //
 // Operators shall not be executed twice.
 //
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
-class AbstractOperator : private Noncopyable {
+class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
  public:
   AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
                    const std::shared_ptr<const AbstractOperator> right = nullptr);
@@ -38,13 +46,47 @@ class AbstractOperator : private Noncopyable {
 
   void execute();
 
-  // returns the result of the operator
+  // Executes the operator, and the inputs it depends on that have not been executed yet, with the Scheduler in a task
+  // of the WorkerPool. Returns immediately, so that a thread can have many operators (e.g., queries) in flight. The
+  // future becomes ready once the operator is executed and rethrows the exception of a failed execution. The operators
+  // it depends on must not be executed by anyone else in the meantime. The operator is kept alive until it is executed,
+  // even if the caller drops its pointers to it.
+  std::shared_future<void> execute_async(const ExecutionMode mode = ExecutionMode::OperatorAtATime);
+
+  // Returns whether the operator has finished executing. Unlike get_output, this does not wait for an asynchronous
+  // execution, but it can be called while the execution is running.
+  bool executed() const;
+
+  // Returns the result of the operator, waiting for an asynchronous execution to finish. If no worker has started the
+  // execution yet, the calling thread executes the operator itself, so that an operator executed on a worker can wait
+  // for another one (see WorkerPool::wait).
   std::shared_ptr<const Table> get_output() const;
 
+  // returns the name of the operator, e.g., "TableScan"
+  virtual const std::string name() const = 0;
+
+  // returns the statistics of the execution (see PerformanceData), waiting for an asynchronous execution
+  const PerformanceData& performance_data() const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
 
+  // Operators that process every chunk of their left input independently of the others, e.g., TableScan and
+  // Projection, can be fused into pipelines that pass chunks (morsels) from one operator to the next without
+  // materializing the tables in between (see Pipeline). They return true here and implement the two methods below.
+  // Their _on_execute usually runs a pipeline of just themselves.
+  virtual bool is_pipelineable() const;
+
+  // Prepares the operator for processing morsels of the given input table, which has the columns of the left input,
+  // and returns an empty output table. Called once before process_morsel.
+  virtual std::shared_ptr<Table> initialize_output_table(const std::shared_ptr<const Table>& input_table);
+
+  // Processes the chunk chunk_id of the input table and returns the corresponding output chunk, which may be empty.
+  // This is called concurrently for different chunks.
+  virtual std::shared_ptr<Chunk> process_morsel(const std::shared_ptr<const Table>& input_table,
+                                                const ChunkID chunk_id) const;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -54,12 +96,24 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
+  // sets the output to the result of execute_function and records its performance data
+  void _execute_and_record(const std::function<std::shared_ptr<const Table>()>& execute_function,
+                           const std::vector<std::shared_ptr<const Table>>& input_tables);
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _input_left;
   std::shared_ptr<const AbstractOperator> _input_right;
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  // set if the operator is executed asynchronously
+  std::shared_ptr<ScheduledTask> _async_execution;
+
+  PerformanceData _performance_data;
+
+  // a Pipeline sets the output and the performance data of the operators it executes
+  friend class Pipeline;
 };
 
 }  // namespace opossum
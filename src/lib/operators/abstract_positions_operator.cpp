@@ -0,0 +1,164 @@
+#include "abstract_positions_operator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "scheduler/worker_pool.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of tasks per worker that the referenced chunks are distributed to
+constexpr auto POSITIONS_TASKS_PER_WORKER = size_t{4};
+
+// returns the ReferenceSegment of the given chunk and column, all of which need to share their positions
+std::shared_ptr<const ReferenceSegment> get_reference_segment(const Chunk& chunk, const ColumnID column_id) {
+  const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+  Assert(segment, "Inputs need to consist of ReferenceSegments");
+  return segment;
+}
+
+}  // namespace
+
+AbstractPositionsOperator::AbstractPositionsOperator(const std::shared_ptr<const AbstractOperator> left,
+                                                     const std::shared_ptr<const AbstractOperator> right)
+    : AbstractOperator(left, right) {
+  Assert(left && right, "Positions operators need two inputs");
+}
+
+std::shared_ptr<const Table> AbstractPositionsOperator::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto column_count = left_table->column_count();
+  Assert(left_table->column_names() == right_table->column_names(), "Inputs need to have the same columns");
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    Assert(left_table->column_type(column_id) == right_table->column_type(column_id),
+           "Inputs need to have the same columns");
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+  if (column_count == 0) return output_table;
+
+  // the first chunk of both inputs is used to find out what they reference, the others are checked against it
+  const auto& left_chunk = left_table->get_chunk(ChunkID{0});
+  const auto& right_chunk = right_table->get_chunk(ChunkID{0});
+  auto referenced_tables = std::vector<std::shared_ptr<const Table>>{};
+  auto referenced_column_ids = std::vector<ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto left_segment = get_reference_segment(left_chunk, column_id);
+    const auto right_segment = get_reference_segment(right_chunk, column_id);
+    Assert(left_segment->referenced_table() == right_segment->referenced_table() &&
+               left_segment->referenced_column_id() == right_segment->referenced_column_id(),
+           "Inputs need to reference the same tables and columns");
+    referenced_tables.emplace_back(left_segment->referenced_table());
+    referenced_column_ids.emplace_back(left_segment->referenced_column_id());
+  }
+
+  const auto& referenced_table = *referenced_tables.front();
+  const auto left_positions = _positions_by_chunk(*left_table, referenced_tables, referenced_column_ids);
+  const auto right_positions = _positions_by_chunk(*right_table, referenced_tables, referenced_column_ids);
+
+  // combine the positions of every referenced chunk, contiguous ranges of chunks are processed in parallel
+  const auto chunk_count = static_cast<size_t>(referenced_table.chunk_count());
+  auto output_positions = std::vector<std::shared_ptr<const ChunkPosList>>(chunk_count);
+  const auto task_count =
+      std::max(size_t{1}, std::min(chunk_count, WorkerPool::get().worker_count() * POSITIONS_TASKS_PER_WORKER));
+
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    tasks.emplace_back([&, task_id]() {
+      const auto first_chunk_id = chunk_count * task_id / task_count;
+      const auto end_chunk_id = chunk_count * (task_id + 1) / task_count;
+      for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        output_positions[chunk_id] = _combine(left_positions[chunk_id], right_positions[chunk_id]);
+      }
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  const auto emplace_output_chunk = [&](const auto& positions) {
+    auto chunk = std::make_shared<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      chunk->add_segment(std::make_shared<ReferenceSegment>(referenced_tables[column_id],
+                                                            referenced_column_ids[column_id], positions));
+    }
+
+    // the first call replaces the existing chunk since it is empty
+    output_table->emplace_chunk(chunk);
+  };
+
+  for (const auto& positions : output_positions) {
+    if (positions && !positions->empty()) emplace_output_chunk(positions);
+  }
+
+  // if no rows are left, a single empty chunk keeps the segments of the result
+  if (output_table->row_count() == 0) emplace_output_chunk(std::make_shared<const PosList>());
+
+  return output_table;
+}
+
+std::vector<std::shared_ptr<const ChunkPosList>> AbstractPositionsOperator::_positions_by_chunk(
+    const Table& input_table, const std::vector<std::shared_ptr<const Table>>& referenced_tables,
+    const std::vector<ColumnID>& referenced_column_ids) {
+  const auto& referenced_table = *referenced_tables.front();
+  const auto referenced_chunk_count = referenced_table.chunk_count();
+  auto positions = std::vector<std::shared_ptr<const ChunkPosList>>(referenced_chunk_count);
+
+  // adds the positions of a ChunkPosList to those of its referenced chunk
+  const auto add_positions = [&](const std::shared_ptr<const ChunkPosList>& chunk_pos_list) {
+    auto& chunk_positions = positions[chunk_pos_list->chunk_id()];
+    chunk_positions = chunk_positions ? ChunkPosList::unite(*chunk_positions, *chunk_pos_list) : chunk_pos_list;
+  };
+
+  // offsets of PosLists are collected per referenced chunk first, they are neither sorted nor unique
+  auto pos_list_offsets = std::vector<std::vector<ChunkOffset>>(referenced_chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table.chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table.get_chunk(chunk_id);
+    const auto segment = get_reference_segment(chunk, ColumnID{0});
+    const auto chunk_pos_list = segment->chunk_pos_list();
+
+    // pos_list() is only called for segments without a ChunkPosList, so nothing is materialized here
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto column_segment = get_reference_segment(chunk, column_id);
+      Assert(column_segment->referenced_table() == referenced_tables[column_id] &&
+                 column_segment->referenced_column_id() == referenced_column_ids[column_id],
+             "Inputs need to reference the same tables and columns in every chunk");
+      Assert(column_segment->chunk_pos_list() == chunk_pos_list &&
+                 (chunk_pos_list || column_segment->pos_list() == segment->pos_list()),
+             "Segments of a chunk need to share their positions");
+    }
+
+    if (chunk_pos_list) {
+      if (!chunk_pos_list->empty()) add_positions(chunk_pos_list);
+      continue;
+    }
+
+    const auto pos_list = segment->pos_list();
+    for (const auto& row_id : *pos_list) {
+      pos_list_offsets[row_id.chunk_id].emplace_back(row_id.chunk_offset);
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    auto& offsets = pos_list_offsets[chunk_id];
+    if (offsets.empty()) continue;
+
+    std::sort(offsets.begin(), offsets.end());
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+    const auto chunk_size = static_cast<ChunkOffset>(referenced_table.get_chunk(chunk_id).size());
+    add_positions(ChunkPosList::make(chunk_id, chunk_size, std::move(offsets)));
+  }
+
+  return positions;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ReferenceSegment;
+
+// AbstractPositionsOperator is the super class of UnionPositions and IntersectPositions. Both combine the rows of two
+// inputs that select rows of the same table, e.g., two TableScans, without looking at any values. Thus, they allow to
+// evaluate disjunctions and conjunctions of predicates whose scans can run independently of each other.
+//
+// Both inputs need to have the same columns and consist of ReferenceSegments that point to the same tables and
+// columns. Within a chunk, all segments of an input need to share their positions, as it is the case for TableScans.
+//
+// The positions of both inputs are grouped by the chunk of the referenced table they point to. For every referenced
+// chunk, they are combined as ChunkPosLists in parallel: sorted offsets are merged, bitmaps are combined bitwise. The
+// output has one chunk per referenced chunk with positions, which are in ascending order and without duplicates.
+class AbstractPositionsOperator : public AbstractOperator {
+ public:
+  AbstractPositionsOperator(const std::shared_ptr<const AbstractOperator> left,
+                            const std::shared_ptr<const AbstractOperator> right);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Combines the positions of both inputs in a referenced chunk. A nullptr stands for no positions, and may also be
+  // returned. This is called concurrently for different chunks.
+  virtual std::shared_ptr<const ChunkPosList> _combine(const std::shared_ptr<const ChunkPosList>& left,
+                                                       const std::shared_ptr<const ChunkPosList>& right) const = 0;
+
+  // Returns the positions of the input table per referenced chunk (nullptr if there are none). Every chunk of the
+  // input table needs to reference the given tables and columns, with positions shared by all of its segments.
+  static std::vector<std::shared_ptr<const ChunkPosList>> _positions_by_chunk(
+      const Table& input_table, const std::vector<std::shared_ptr<const Table>>& referenced_tables,
+      const std::vector<ColumnID>& referenced_column_ids);
+};
+
+}  // namespace opossum
@@ -0,0 +1,675 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// number of tasks per worker that the chunks of the input are distributed to for the pre-aggregation
+constexpr auto AGGREGATE_TASKS_PER_WORKER = size_t{4};
+
+// below this number of pre-aggregated groups, the merge is not parallelized
+constexpr auto MIN_GROUPS_FOR_PARALLEL_MERGE = size_t{4096};
+
+// marks local groups that are not merged into the current partition
+constexpr auto NO_GROUP = std::numeric_limits<uint32_t>::max();
+
+namespace {
+
+// combines the key parts of a group into a single hash
+uint64_t hash_key(const uint64_t* key, const size_t key_width) {
+  auto hash = uint64_t{0x9e3779b97f4a7c15};
+  for (auto key_index = size_t{0}; key_index < key_width; ++key_index) {
+    hash ^= key[key_index];
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 32;
+  }
+  return hash;
+}
+
+// the partition of a group during the merge, uses other bits of the hash than the GroupTable
+size_t merge_partition(const uint64_t hash, const size_t partition_count) {
+  return (hash >> 40) & (partition_count - 1);
+}
+
+}  // namespace
+
+class Aggregate::GroupTable {
+ public:
+  explicit GroupTable(const size_t key_width) : _key_width(key_width), _slots(INITIAL_SLOT_COUNT) {}
+
+  // returns the id of the group with the given key and hash, the group is created if it does not exist yet
+  uint32_t find_or_insert(const uint64_t* key, const uint64_t hash) {
+    const auto slot_mask = _slots.size() - 1;
+    const auto tag = static_cast<uint32_t>(hash >> 32);
+
+    // linear probing, the tag avoids looking at the keys of most other groups
+    for (auto slot_index = hash & slot_mask;; slot_index = (slot_index + 1) & slot_mask) {
+      auto& slot = _slots[slot_index];
+      if (slot.group_id == NO_GROUP) {
+        const auto group_id = static_cast<uint32_t>(_hashes.size());
+        slot = Slot{tag, group_id};
+        _hashes.emplace_back(hash);
+        _keys.insert(_keys.end(), key, key + _key_width);
+
+        // keep the load factor below one half
+        if (_hashes.size() * 2 > _slots.size()) _grow();
+        return group_id;
+      }
+
+      if (slot.tag == tag && std::equal(key, key + _key_width, this->key(slot.group_id))) return slot.group_id;
+    }
+  }
+
+  size_t group_count() const { return _hashes.size(); }
+
+  const uint64_t* key(const uint32_t group_id) const { return _keys.data() + group_id * _key_width; }
+
+  uint64_t hash(const uint32_t group_id) const { return _hashes[group_id]; }
+
+ protected:
+  static constexpr auto INITIAL_SLOT_COUNT = size_t{64};
+
+  struct Slot {
+    uint32_t tag = 0;
+    uint32_t group_id = NO_GROUP;
+  };
+
+  void _grow() {
+    _slots = std::vector<Slot>(_slots.size() * 2);
+    const auto slot_mask = _slots.size() - 1;
+    for (auto group_id = uint32_t{0}; group_id < _hashes.size(); ++group_id) {
+      auto slot_index = _hashes[group_id] & slot_mask;
+      while (_slots[slot_index].group_id != NO_GROUP) slot_index = (slot_index + 1) & slot_mask;
+      _slots[slot_index] = Slot{static_cast<uint32_t>(_hashes[group_id] >> 32), group_id};
+    }
+  }
+
+  const size_t _key_width;
+  std::vector<Slot> _slots;
+
+  // the key parts and the hash of every group
+  std::vector<uint64_t> _keys;
+  std::vector<uint64_t> _hashes;
+};
+
+class Aggregate::BaseKeyEncoder {
+ public:
+  virtual ~BaseKeyEncoder() = default;
+
+  // Encodes the values of the column into part key_index of the keys of every row. The keys of a chunk are stored
+  // row by row, key_width parts each. Different encoders can run concurrently on the same keys.
+  //
+  // If chunk_dictionary_parts is given, the encoder is the only one and allocates the keys itself. Chunks whose
+  // segment is a DictionarySegment are then not encoded row by row. Instead, only the key parts of their dictionary
+  // entries are stored in chunk_dictionary_parts, and their rows are grouped by value id (see attribute_vector).
+  virtual void encode(const Table& table, const ColumnID column_id, const size_t key_index, const size_t key_width,
+                      std::vector<std::vector<uint64_t>>& chunk_keys,
+                      std::vector<std::vector<uint64_t>>* chunk_dictionary_parts) = 0;
+
+  // returns the value ids of the segment if it is a DictionarySegment, nullptr otherwise
+  virtual const BaseAttributeVector* attribute_vector(const BaseSegment& segment) const = 0;
+
+  // returns a segment with the decoded key part key_index of every group of the table
+  virtual std::shared_ptr<BaseSegment> decode(const GroupTable& group_table, const size_t key_index) const = 0;
+};
+
+template <typename T>
+class Aggregate::KeyEncoder : public BaseKeyEncoder {
+ public:
+  void encode(const Table& table, const ColumnID column_id, const size_t key_index, const size_t key_width,
+              std::vector<std::vector<uint64_t>>& chunk_keys,
+              std::vector<std::vector<uint64_t>>* chunk_dictionary_parts) override {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+
+      if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+        // encode every dictionary entry only once
+        auto dictionary_parts = std::vector<uint64_t>{};
+        for (const auto& value : *dictionary_segment->dictionary()) {
+          dictionary_parts.emplace_back(_encode(value));
+        }
+
+        if (chunk_dictionary_parts) {
+          (*chunk_dictionary_parts)[chunk_id] = std::move(dictionary_parts);
+          continue;
+        }
+
+        auto* keys = chunk_keys[chunk_id].data();
+        resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+          for (auto row = size_t{0}; row < value_ids.size(); ++row) {
+            keys[row * key_width + key_index] = dictionary_parts[value_ids[row]];
+          }
+        });
+        continue;
+      }
+
+      if (chunk_dictionary_parts) chunk_keys[chunk_id].resize(segment.size());
+      auto* keys = chunk_keys[chunk_id].data();
+      resolve_segment_values<T>(segment, [&](const size_t row, const T& value) {
+        keys[row * key_width + key_index] = _encode(value);
+      });
+    }
+  }
+
+  const BaseAttributeVector* attribute_vector(const BaseSegment& segment) const override {
+    const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+    return dictionary_segment ? dictionary_segment->attribute_vector().get() : nullptr;
+  }
+
+  std::shared_ptr<BaseSegment> decode(const GroupTable& group_table, const size_t key_index) const override {
+    auto values = std::vector<T>{};
+    values.reserve(group_table.group_count());
+    for (auto group_id = uint32_t{0}; group_id < group_table.group_count(); ++group_id) {
+      values.emplace_back(_decode(group_table.key(group_id)[key_index]));
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+
+ protected:
+  uint64_t _encode(const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      // strings are numbered in the order in which they are first seen
+      const auto [iter, inserted] = _string_ids.emplace(value, _strings.size());  // NOLINT
+      if (inserted) _strings.emplace_back(value);
+      return iter->second;
+    } else if constexpr (std::is_floating_point_v<T>) {  // NOLINT
+      // -0.0 and 0.0 belong to the same group
+      const auto normalized_value = value == T{0} ? T{0} : value;
+      auto part = uint64_t{0};
+      std::memcpy(&part, &normalized_value, sizeof(T));
+      return part;
+    } else {
+      return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+  }
+
+  T _decode(const uint64_t part) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _strings[part];
+    } else if constexpr (std::is_floating_point_v<T>) {  // NOLINT
+      auto value = T{};
+      std::memcpy(&value, &part, sizeof(T));
+      return value;
+    } else {
+      return static_cast<T>(static_cast<int64_t>(part));
+    }
+  }
+
+  // only used for strings
+  std::unordered_map<std::string, uint64_t> _string_ids;
+  std::vector<std::string> _strings;
+};
+
+class Aggregate::BaseAggregator {
+ public:
+  virtual ~BaseAggregator() = default;
+
+  // returns an aggregator for the same aggregate without any groups
+  virtual std::unique_ptr<BaseAggregator> create_empty() const = 0;
+
+  // Adds the rows of a chunk to their groups. group_ids holds the group of every row, segment is the aggregated
+  // segment of the chunk (nullptr for COUNT(*)). The narrower group ids are the value ids of a DictionarySegment,
+  // which are used as they are stored in its attribute vector.
+  virtual void aggregate(const BaseSegment* segment, const std::vector<uint8_t>& group_ids,
+                         const size_t group_count) = 0;
+  virtual void aggregate(const BaseSegment* segment, const std::vector<uint16_t>& group_ids,
+                         const size_t group_count) = 0;
+  virtual void aggregate(const BaseSegment* segment, const std::vector<uint32_t>& group_ids,
+                         const size_t group_count) = 0;
+
+  // merges every group of other into the group given by group_mapping (unless it is NO_GROUP)
+  virtual void merge(const BaseAggregator& other, const std::vector<uint32_t>& group_mapping,
+                     const size_t group_count) = 0;
+
+  // returns the results of all groups
+  virtual std::shared_ptr<BaseSegment> result_segment() const = 0;
+
+  // returns the type of the results
+  virtual std::string result_type() const = 0;
+};
+
+// implements aggregate() for all widths of group ids by calling Derived::_aggregate, which is a template
+template <typename Derived>
+class Aggregate::AbstractAggregator : public BaseAggregator {
+ public:
+  void aggregate(const BaseSegment* segment, const std::vector<uint8_t>& group_ids,
+                 const size_t group_count) override {
+    static_cast<Derived&>(*this)._aggregate(segment, group_ids, group_count);
+  }
+
+  void aggregate(const BaseSegment* segment, const std::vector<uint16_t>& group_ids,
+                 const size_t group_count) override {
+    static_cast<Derived&>(*this)._aggregate(segment, group_ids, group_count);
+  }
+
+  void aggregate(const BaseSegment* segment, const std::vector<uint32_t>& group_ids,
+                 const size_t group_count) override {
+    static_cast<Derived&>(*this)._aggregate(segment, group_ids, group_count);
+  }
+};
+
+class Aggregate::CountAggregator : public AbstractAggregator<CountAggregator> {
+ public:
+  std::unique_ptr<BaseAggregator> create_empty() const override { return std::make_unique<CountAggregator>(); }
+
+  void merge(const BaseAggregator& other, const std::vector<uint32_t>& group_mapping,
+             const size_t group_count) override {
+    const auto& other_counts = static_cast<const CountAggregator&>(other)._counts;
+    _counts.resize(group_count);
+    for (auto group_id = size_t{0}; group_id < group_mapping.size(); ++group_id) {
+      if (group_mapping[group_id] != NO_GROUP) _counts[group_mapping[group_id]] += other_counts[group_id];
+    }
+  }
+
+  std::shared_ptr<BaseSegment> result_segment() const override {
+    return std::make_shared<ValueSegment<int64_t>>(_counts);
+  }
+
+  std::string result_type() const override { return "long"; }
+
+ protected:
+  friend class AbstractAggregator<CountAggregator>;
+
+  template <typename GroupID>
+  void _aggregate(const BaseSegment*, const std::vector<GroupID>& group_ids, const size_t group_count) {
+    _counts.resize(group_count);
+    for (const auto group_id : group_ids) {
+      ++_counts[group_id];
+    }
+  }
+
+  std::vector<int64_t> _counts;
+};
+
+// computes SUM or, if average is set, AVG
+template <typename T>
+class Aggregate::SumAggregator : public AbstractAggregator<SumAggregator<T>> {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit SumAggregator(const bool average) : _average(average) {}
+
+  std::unique_ptr<BaseAggregator> create_empty() const override {
+    return std::make_unique<SumAggregator<T>>(_average);
+  }
+
+  void merge(const BaseAggregator& other, const std::vector<uint32_t>& group_mapping,
+             const size_t group_count) override {
+    const auto& other_aggregator = static_cast<const SumAggregator<T>&>(other);
+    _sums.resize(group_count);
+    _counts.resize(group_count);
+    for (auto group_id = size_t{0}; group_id < group_mapping.size(); ++group_id) {
+      if (group_mapping[group_id] == NO_GROUP) continue;
+      _sums[group_mapping[group_id]] += other_aggregator._sums[group_id];
+      _counts[group_mapping[group_id]] += other_aggregator._counts[group_id];
+    }
+  }
+
+  std::shared_ptr<BaseSegment> result_segment() const override {
+    if (!_average) return std::make_shared<ValueSegment<SumType>>(_sums);
+
+    auto averages = std::vector<double>(_sums.size());
+    for (auto group_id = size_t{0}; group_id < _sums.size(); ++group_id) {
+      averages[group_id] = static_cast<double>(_sums[group_id]) / static_cast<double>(_counts[group_id]);
+    }
+    return std::make_shared<ValueSegment<double>>(std::move(averages));
+  }
+
+  std::string result_type() const override { return _average || !std::is_integral_v<T> ? "double" : "long"; }
+
+ protected:
+  friend class AbstractAggregator<SumAggregator<T>>;
+
+  template <typename GroupID>
+  void _aggregate(const BaseSegment* segment, const std::vector<GroupID>& group_ids, const size_t group_count) {
+    _sums.resize(group_count);
+    _counts.resize(group_count);
+    resolve_segment_values<T>(*segment, [&](const size_t row, const T& value) { _sums[group_ids[row]] += value; });
+    for (const auto group_id : group_ids) {
+      ++_counts[group_id];
+    }
+  }
+
+  const bool _average;
+  std::vector<SumType> _sums;
+  std::vector<int64_t> _counts;
+};
+
+// computes MIN or, if minimum is not set, MAX
+template <typename T>
+class Aggregate::MinMaxAggregator : public AbstractAggregator<MinMaxAggregator<T>> {
+ public:
+  MinMaxAggregator(const bool minimum, const std::string& type) : _minimum(minimum), _type(type) {}
+
+  std::unique_ptr<BaseAggregator> create_empty() const override {
+    return std::make_unique<MinMaxAggregator<T>>(_minimum, _type);
+  }
+
+  void merge(const BaseAggregator& other, const std::vector<uint32_t>& group_mapping,
+             const size_t group_count) override {
+    const auto& other_aggregator = static_cast<const MinMaxAggregator<T>&>(other);
+    _values.resize(group_count);
+    _initialized.resize(group_count);
+    for (auto group_id = size_t{0}; group_id < group_mapping.size(); ++group_id) {
+      if (group_mapping[group_id] != NO_GROUP) _update(group_mapping[group_id], other_aggregator._values[group_id]);
+    }
+  }
+
+  std::shared_ptr<BaseSegment> result_segment() const override {
+    return std::make_shared<ValueSegment<T>>(_values);
+  }
+
+  std::string result_type() const override { return _type; }
+
+ protected:
+  friend class AbstractAggregator<MinMaxAggregator<T>>;
+
+  template <typename GroupID>
+  void _aggregate(const BaseSegment* segment, const std::vector<GroupID>& group_ids, const size_t group_count) {
+    _values.resize(group_count);
+    _initialized.resize(group_count);
+    resolve_segment_values<T>(*segment, [&](const size_t row, const T& value) { _update(group_ids[row], value); });
+  }
+
+  void _update(const uint32_t group_id, const T& value) {
+    auto& current_value = _values[group_id];
+    if (!_initialized[group_id] || (_minimum ? value < current_value : current_value < value)) {
+      current_value = value;
+      _initialized[group_id] = true;
+    }
+  }
+
+  const bool _minimum;
+  const std::string _type;
+  std::vector<T> _values;
+  std::vector<bool> _initialized;
+};
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in, std::vector<AggregateDefinition> aggregates,
+                     std::vector<ColumnID> group_by_column_ids)
+    : AbstractOperator(in), _aggregates(std::move(aggregates)), _group_by_column_ids(std::move(group_by_column_ids)) {
+  Assert(!_aggregates.empty() || !_group_by_column_ids.empty(), "Aggregate needs aggregates or group by columns");
+  for (const auto& aggregate : _aggregates) {
+    Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+           "Only COUNT can be used without a column");
+  }
+}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::string Aggregate::_aggregate_column_name(const AggregateDefinition& aggregate) const {
+  const auto column_name = aggregate.column_id ? _input_table_left()->column_name(*aggregate.column_id) : "*";
+  switch (aggregate.function) {
+    case AggregateFunction::Count:
+      return "COUNT(" + column_name + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + column_name + ")";
+    case AggregateFunction::Min:
+      return "MIN(" + column_name + ")";
+    case AggregateFunction::Max:
+      return "MAX(" + column_name + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + column_name + ")";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+template <typename ValueIDType>
+void Aggregate::_aggregate_by_value_ids(const Chunk& chunk, const std::vector<ValueIDType>& value_ids,
+                                        const std::vector<uint64_t>& dictionary_parts, GroupTable& group_table,
+                                        std::vector<std::unique_ptr<BaseAggregator>>& aggregators) const {
+  // the value ids are the group ids of the chunk, so the aggregates are computed in dense arrays without hashing
+  if (value_ids.empty()) return;
+
+  // every dictionary entry occurs in the chunk, so every value id is a group
+  const auto value_id_count = dictionary_parts.size();
+  auto chunk_aggregators = std::vector<std::unique_ptr<BaseAggregator>>{};
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    const auto& column_id = _aggregates[aggregate_index].column_id;
+    const auto* segment = column_id ? chunk.get_segment(*column_id).get() : nullptr;
+    chunk_aggregators.emplace_back(aggregators[aggregate_index]->create_empty());
+    chunk_aggregators.back()->aggregate(segment, value_ids, value_id_count);
+  }
+
+  // remap the value ids of the chunk to the groups of the table through the encoded dictionary
+  auto group_mapping = std::vector<uint32_t>(value_id_count);
+  for (auto value_id = size_t{0}; value_id < value_id_count; ++value_id) {
+    const auto* key = &dictionary_parts[value_id];
+    group_mapping[value_id] = group_table.find_or_insert(key, hash_key(key, 1));
+  }
+
+  for (auto aggregate_index = size_t{0}; aggregate_index < aggregators.size(); ++aggregate_index) {
+    aggregators[aggregate_index]->merge(*chunk_aggregators[aggregate_index], group_mapping,
+                                        group_table.group_count());
+  }
+}
+
+const std::string Aggregate::name() const { return "Aggregate"; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = static_cast<size_t>(input_table->chunk_count());
+  const auto key_width = _group_by_column_ids.size();
+
+  // create a key encoder per group by column and an aggregator per aggregate
+  auto key_encoders = std::vector<std::unique_ptr<BaseKeyEncoder>>{};
+  for (const auto& column_id : _group_by_column_ids) {
+    key_encoders.emplace_back(
+        make_unique_by_data_type<BaseKeyEncoder, KeyEncoder>(input_table->column_type(column_id)));
+  }
+
+  auto prototype_aggregators = std::vector<std::unique_ptr<BaseAggregator>>{};
+  for (const auto& aggregate : _aggregates) {
+    if (aggregate.function == AggregateFunction::Count) {
+      prototype_aggregators.emplace_back(std::make_unique<CountAggregator>());
+      continue;
+    }
+
+    const auto& column_type = input_table->column_type(*aggregate.column_id);
+    resolve_data_type(column_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if (aggregate.function == AggregateFunction::Min || aggregate.function == AggregateFunction::Max) {
+        prototype_aggregators.emplace_back(std::make_unique<MinMaxAggregator<ColumnDataType>>(
+            aggregate.function == AggregateFunction::Min, column_type));
+      } else if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        prototype_aggregators.emplace_back(
+            std::make_unique<SumAggregator<ColumnDataType>>(aggregate.function == AggregateFunction::Avg));
+      } else {
+        Fail("SUM and AVG are only defined for numeric columns");
+      }
+    });
+  }
+
+  // 1. encode the group by columns into keys, in parallel per column. With a single group by column, the rows of
+  // dictionary encoded chunks are grouped by their value ids instead, so only their dictionaries are encoded.
+  const auto group_by_value_ids = key_width == 1;
+  auto chunk_keys = std::vector<std::vector<uint64_t>>(chunk_count);
+  auto chunk_dictionary_parts = std::vector<std::vector<uint64_t>>(chunk_count);
+  if (!group_by_value_ids) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunk_keys[chunk_id].resize(input_table->get_chunk(chunk_id).size() * key_width);
+    }
+  }
+
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto key_index = size_t{0}; key_index < key_width; ++key_index) {
+    tasks.emplace_back([&, key_index]() {
+      key_encoders[key_index]->encode(*input_table, _group_by_column_ids[key_index], key_index, key_width,
+                                      chunk_keys, group_by_value_ids ? &chunk_dictionary_parts : nullptr);
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  // 2. pre-aggregate ranges of chunks in parallel, each into its own table
+  struct LocalAggregation {
+    explicit LocalAggregation(const size_t key_width) : group_table(key_width) {}
+
+    GroupTable group_table;
+    std::vector<std::unique_ptr<BaseAggregator>> aggregators;
+  };
+
+  const auto task_count =
+      std::max(size_t{1}, std::min(chunk_count, WorkerPool::get().worker_count() * AGGREGATE_TASKS_PER_WORKER));
+  auto local_aggregations = std::vector<LocalAggregation>{};
+  local_aggregations.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    local_aggregations.emplace_back(key_width);
+  }
+
+  tasks.clear();
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    tasks.emplace_back([&, task_id]() {
+      auto& local_aggregation = local_aggregations[task_id];
+      for (const auto& prototype_aggregator : prototype_aggregators) {
+        local_aggregation.aggregators.emplace_back(prototype_aggregator->create_empty());
+      }
+
+      const auto first_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * task_id / task_count)};
+      const auto end_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * (task_id + 1) / task_count)};
+      auto group_ids = std::vector<uint32_t>{};
+
+      for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto& chunk = input_table->get_chunk(chunk_id);
+
+        const auto& dictionary_parts = chunk_dictionary_parts[chunk_id];
+        if (!dictionary_parts.empty()) {
+          const auto attribute_vector =
+              key_encoders.front()->attribute_vector(*chunk.get_segment(_group_by_column_ids.front()));
+          DebugAssert(attribute_vector, "Value ids can only be used for dictionary segments");
+          resolve_attribute_vector_width(*attribute_vector, [&](const auto& value_ids) {
+            _aggregate_by_value_ids(chunk, value_ids, dictionary_parts, local_aggregation.group_table,
+                                    local_aggregation.aggregators);
+          });
+          continue;
+        }
+
+        const auto* keys = chunk_keys[chunk_id].data();
+
+        group_ids.resize(chunk.size());
+        for (auto row = size_t{0}; row < group_ids.size(); ++row) {
+          const auto* key = keys + row * key_width;
+          group_ids[row] = local_aggregation.group_table.find_or_insert(key, hash_key(key, key_width));
+        }
+        if (group_ids.empty()) continue;
+
+        const auto group_count = local_aggregation.group_table.group_count();
+        for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+          const auto& column_id = _aggregates[aggregate_index].column_id;
+          const auto* segment = column_id ? chunk.get_segment(*column_id).get() : nullptr;
+          local_aggregation.aggregators[aggregate_index]->aggregate(segment, group_ids, group_count);
+        }
+      }
+
+      // the keys of these chunks are not needed anymore
+      for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        chunk_keys[chunk_id] = {};
+        chunk_dictionary_parts[chunk_id] = {};
+      }
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  // 3. merge the partitions of the local tables in parallel
+  auto local_group_count = size_t{0};
+  for (const auto& local_aggregation : local_aggregations) {
+    local_group_count += local_aggregation.group_table.group_count();
+  }
+
+  auto partition_count = size_t{1};
+  if (local_group_count >= MIN_GROUPS_FOR_PARALLEL_MERGE) {
+    while (partition_count < WorkerPool::get().worker_count() * AGGREGATE_TASKS_PER_WORKER) partition_count <<= 1;
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(partition_count);
+  tasks.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    tasks.emplace_back([&, partition_id]() {
+      auto group_table = GroupTable{key_width};
+      auto aggregators = std::vector<std::unique_ptr<BaseAggregator>>{};
+      for (const auto& prototype_aggregator : prototype_aggregators) {
+        aggregators.emplace_back(prototype_aggregator->create_empty());
+      }
+
+      for (const auto& local_aggregation : local_aggregations) {
+        const auto& local_group_table = local_aggregation.group_table;
+        auto group_mapping = std::vector<uint32_t>(local_group_table.group_count(), NO_GROUP);
+        for (auto group_id = uint32_t{0}; group_id < local_group_table.group_count(); ++group_id) {
+          const auto hash = local_group_table.hash(group_id);
+          if (merge_partition(hash, partition_count) != partition_id) continue;
+          group_mapping[group_id] = group_table.find_or_insert(local_group_table.key(group_id), hash);
+        }
+
+        for (auto aggregate_index = size_t{0}; aggregate_index < aggregators.size(); ++aggregate_index) {
+          aggregators[aggregate_index]->merge(*local_aggregation.aggregators[aggregate_index], group_mapping,
+                                              group_table.group_count());
+        }
+      }
+
+      // without group by columns, all rows form the single global group, which also exists for an empty input
+      if (key_width == 0 && local_group_count == 0) {
+        for (auto& aggregator : aggregators) aggregator->merge(*aggregator->create_empty(), {}, 1);
+      } else if (group_table.group_count() == 0) {
+        return;
+      }
+
+      auto chunk = std::make_shared<Chunk>();
+      for (auto key_index = size_t{0}; key_index < key_width; ++key_index) {
+        chunk->add_segment(key_encoders[key_index]->decode(group_table, key_index));
+      }
+      for (const auto& aggregator : aggregators) {
+        chunk->add_segment(aggregator->result_segment());
+      }
+      output_chunks[partition_id] = chunk;
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  // create the output table
+  auto output_table = std::make_shared<Table>();
+  for (const auto& column_id : _group_by_column_ids) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    output_table->add_column_definition(_aggregate_column_name(_aggregates[aggregate_index]),
+                                        prototype_aggregators[aggregate_index]->result_type());
+  }
+
+  for (const auto& chunk : output_chunks) {
+    // the first call replaces the existing chunk since it is empty
+    if (chunk) output_table->emplace_chunk(chunk);
+  }
+
+  // without any groups, a single empty chunk keeps the segments of the result
+  if (output_table->row_count() == 0) {
+    auto chunk = std::make_shared<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < output_table->column_count(); ++column_id) {
+      chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(output_table->column_type(column_id)));
+    }
+    output_table->emplace_chunk(chunk);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
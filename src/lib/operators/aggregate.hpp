@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+enum class AggregateFunction { Count, Sum, Min, Max, Avg };
+
+// An aggregate that is computed for every group, e.g., SUM(column). COUNT can be used without a column (COUNT(*)).
+struct AggregateDefinition {
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+// Operator that groups its input by the given columns and computes the aggregates for every group. Without group by
+// columns, all rows form a single group. The output has one row per group, which consists of the group by columns
+// followed by one column per aggregate (named, e.g., "SUM(b)"). COUNT returns longs, SUM longs for integral and
+// doubles for floating point columns, AVG doubles, and MIN and MAX keep the type of their column. With group by
+// columns, an empty input has no groups and therefore no output rows. Without them, the single global group always
+// exists. As there are no NULLs, its aggregates over an empty input are 0 for COUNT and SUM, NaN for AVG, and the
+// default value of the column type (0 or "") for MIN and MAX.
+//
+// The operator works in three steps:
+//  1. Every group by column is encoded into one 64-bit key part per row, in parallel per column. Numbers are
+//     reinterpreted, strings are numbered. For dictionary segments, only the dictionary entries are encoded.
+//  2. Ranges of chunks are pre-aggregated in parallel, each into its own open-addressing hash table of groups. The
+//     aggregates are updated column-at-a-time per chunk with typed access to the segments.
+//     If there is a single group by column and its segment is a DictionarySegment, the chunk is aggregated into
+//     dense arrays indexed by value id instead, so that no row is hashed. Only the partial results of the value ids
+//     are then remapped into the hash table through the chunk's dictionary.
+//  3. The groups are split into partitions by their hash, and every partition is merged from all thread-local tables
+//     in parallel. Each partition becomes an output chunk.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, std::vector<AggregateDefinition> aggregates,
+            std::vector<ColumnID> group_by_column_ids);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // returns the name of the output column of an aggregate, e.g., "SUM(b)"
+  std::string _aggregate_column_name(const AggregateDefinition& aggregate) const;
+
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+
+  // An open-addressing hash table that maps the keys of groups to consecutive group ids
+  class GroupTable;
+
+  // Maps the values of a group by column to key parts and back
+  class BaseKeyEncoder;
+
+  template <typename T>
+  class KeyEncoder;
+
+  // Keeps the state of one aggregate for all groups of a GroupTable
+  class BaseAggregator;
+
+  template <typename Derived>
+  class AbstractAggregator;
+
+  class CountAggregator;
+
+  template <typename T>
+  class SumAggregator;
+
+  template <typename T>
+  class MinMaxAggregator;
+
+  // Pre-aggregates a chunk whose only group by segment is a DictionarySegment, see _on_execute. value_ids are the
+  // values of its attribute vector, dictionary_parts holds the key part of every dictionary entry.
+  template <typename ValueIDType>
+  void _aggregate_by_value_ids(const Chunk& chunk, const std::vector<ValueIDType>& value_ids,
+                               const std::vector<uint64_t>& dictionary_parts, GroupTable& group_table,
+                               std::vector<std::unique_ptr<BaseAggregator>>& aggregators) const;
+};
+
+}  // namespace opossum
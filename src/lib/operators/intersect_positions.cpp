@@ -0,0 +1,16 @@
+#include "intersect_positions.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+const std::string IntersectPositions::name() const { return "IntersectPositions"; }
+
+std::shared_ptr<const ChunkPosList> IntersectPositions::_combine(
+    const std::shared_ptr<const ChunkPosList>& left, const std::shared_ptr<const ChunkPosList>& right) const {
+  if (!left || !right) return nullptr;
+  return ChunkPosList::intersect(*left, *right);
+}
+
+}  // namespace opossum
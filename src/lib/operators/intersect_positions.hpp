@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_positions_operator.hpp"
+
+namespace opossum {
+
+// Operator that returns the rows that are selected by both of its inputs, e.g., to evaluate a = 1 AND b = 2 with two
+// TableScans that can run independently of each other. See AbstractPositionsOperator for details.
+class IntersectPositions : public AbstractPositionsOperator {
+ public:
+  using AbstractPositionsOperator::AbstractPositionsOperator;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const ChunkPosList> _combine(const std::shared_ptr<const ChunkPosList>& left,
+                                               const std::shared_ptr<const ChunkPosList>& right) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,227 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// the partitions of the build side should fit into the L2 cache
+constexpr auto JOIN_CACHE_SIZE = size_t{256 * 1024};
+
+// more partitions make partitioning more expensive, as every partition is written to concurrently
+constexpr auto MAX_RADIX_BITS = size_t{12};
+
+template <typename T>
+class JoinHash::JoinHashImpl : public BaseJoinHashImpl {
+ public:
+  explicit JoinHashImpl(JoinHash& join) : _join(join) {}
+
+  std::shared_ptr<const Table> on_execute() override {
+    const auto left_table = _join._input_table_left();
+    const auto right_table = _join._input_table_right();
+
+    // the smaller input is used to build the hash tables
+    const auto build_left = left_table->row_count() <= right_table->row_count();
+    const auto radix_bits = _radix_bits(std::min(left_table->row_count(), right_table->row_count()));
+    const auto partition_count = size_t{1} << radix_bits;
+
+    const auto left_partitions = _partition(*left_table, _join._column_ids.first, radix_bits);
+    const auto right_partitions = _partition(*right_table, _join._column_ids.second, radix_bits);
+    const auto& build_partitions = build_left ? left_partitions : right_partitions;
+    const auto& probe_partitions = build_left ? right_partitions : left_partitions;
+
+    const auto left_writer = ReferenceSegmentWriter(left_table);
+    const auto right_writer = ReferenceSegmentWriter(right_table);
+
+    // build and probe every partition in parallel, every task creates the output chunks of its partition
+    auto output_table = _join._initialize_output_table();
+    auto output_chunks = std::vector<std::vector<std::shared_ptr<Chunk>>>(partition_count);
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      tasks.emplace_back([&, partition_id]() {
+        auto left_positions = std::make_shared<PosList>();
+        auto right_positions = std::make_shared<PosList>();
+        _build_and_probe(build_partitions[partition_id], probe_partitions[partition_id], radix_bits,
+                         build_left ? *left_positions : *right_positions,
+                         build_left ? *right_positions : *left_positions);
+        if (left_positions->empty()) return;
+
+        output_chunks[partition_id] = JoinHash::_make_output_chunks(left_writer, right_writer, left_positions,
+                                                                    right_positions, output_table->chunk_size());
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    for (const auto& chunks : output_chunks) {
+      // the first call replaces the existing chunk since it is empty
+      for (const auto& chunk : chunks) output_table->emplace_chunk(chunk);
+    }
+
+    // if nothing matched, a single empty chunk keeps the segments of the result
+    if (output_table->row_count() == 0) {
+      const auto no_positions = std::make_shared<const PosList>();
+      const auto chunks = JoinHash::_make_output_chunks(left_writer, right_writer, no_positions, no_positions,
+                                                        output_table->chunk_size());
+      output_table->emplace_chunk(chunks.front());
+    }
+
+    return output_table;
+  }
+
+ protected:
+  // a materialized value of the join column, its hash, and its position in the input table
+  struct Element {
+    T value;
+    uint64_t hash;
+    RowID row_id;
+  };
+
+  using Partition = std::vector<Element>;
+
+  // std::hash is the identity for integers, so its bits are mixed to spread clustered keys over all partitions
+  static uint64_t _hash(const T& value) {
+    auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  // returns the number of radix bits, so that the partitions of the build side fit into the cache and there are enough
+  // partitions to keep all workers busy
+  static size_t _radix_bits(const size_t build_row_count) {
+    const auto cache_partitions = build_row_count * sizeof(Element) / JOIN_CACHE_SIZE + 1;
+    const auto partition_count = std::max(cache_partitions, WorkerPool::get().worker_count());
+
+    auto radix_bits = size_t{0};
+    while ((size_t{1} << radix_bits) < partition_count && radix_bits < MAX_RADIX_BITS) ++radix_bits;
+    return radix_bits;
+  }
+
+  // materializes the values of the given column and partitions them by the lowest radix_bits bits of their hash.
+  // Within a partition, the elements are ordered by their position in the input table.
+  static std::vector<Partition> _partition(const Table& table, const ColumnID column_id, const size_t radix_bits) {
+    const auto chunk_count = static_cast<size_t>(table.chunk_count());
+    const auto partition_count = size_t{1} << radix_bits;
+    const auto partition_mask = partition_count - 1;
+
+    // materialize every chunk and count how many of its elements fall into every partition
+    auto chunk_elements = std::vector<std::vector<Element>>(chunk_count);
+    auto chunk_histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      tasks.emplace_back([&, chunk_id]() {
+        const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+        auto& elements = chunk_elements[chunk_id];
+        elements.resize(segment.size());
+        resolve_segment_values<T>(segment, [&](const size_t position, const T& value) {
+          elements[position] = Element{value, _hash(value), RowID{chunk_id, static_cast<ChunkOffset>(position)}};
+        });
+
+        auto& histogram = chunk_histograms[chunk_id];
+        for (const auto& element : elements) {
+          ++histogram[element.hash & partition_mask];
+        }
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    // turn the histograms into the offsets at which every chunk writes into every partition
+    auto partitions = std::vector<Partition>(partition_count);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      auto partition_size = size_t{0};
+      for (auto& histogram : chunk_histograms) {
+        const auto chunk_partition_size = histogram[partition_id];
+        histogram[partition_id] = partition_size;
+        partition_size += chunk_partition_size;
+      }
+      partitions[partition_id].resize(partition_size);
+    }
+
+    // every chunk writes to its own ranges of the partitions, so the elements can be scattered in parallel
+    tasks.clear();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      tasks.emplace_back([&, chunk_id]() {
+        auto& write_offsets = chunk_histograms[chunk_id];
+        for (auto& element : chunk_elements[chunk_id]) {
+          const auto partition_id = element.hash & partition_mask;
+          partitions[partition_id][write_offsets[partition_id]++] = std::move(element);
+        }
+        chunk_elements[chunk_id] = {};
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    return partitions;
+  }
+
+  // builds a hash table over the build partition and adds the positions of all matching pairs of elements
+  static void _build_and_probe(const Partition& build_partition, const Partition& probe_partition,
+                               const size_t radix_bits, PosList& build_positions, PosList& probe_positions) {
+    if (build_partition.empty() || probe_partition.empty()) return;
+
+    // The hash table chains the elements of the build partition: buckets holds the index of the first element of
+    // every bucket, next_elements the index of the element that follows each element. As the lowest bits of the hash
+    // are the same within a partition, the buckets are determined by the following bits.
+    constexpr auto NO_ELEMENT = std::numeric_limits<size_t>::max();
+    auto bucket_count = size_t{1};
+    while (bucket_count < build_partition.size()) bucket_count <<= 1;
+    const auto bucket_mask = bucket_count - 1;
+
+    auto buckets = std::vector<size_t>(bucket_count, NO_ELEMENT);
+    auto next_elements = std::vector<size_t>(build_partition.size());
+
+    // insert in reverse order, so that every chain lists its elements in the order of the input
+    for (auto element_index = build_partition.size(); element_index-- > 0;) {
+      auto& bucket = buckets[(build_partition[element_index].hash >> radix_bits) & bucket_mask];
+      next_elements[element_index] = bucket;
+      bucket = element_index;
+    }
+
+    for (const auto& probe_element : probe_partition) {
+      auto element_index = buckets[(probe_element.hash >> radix_bits) & bucket_mask];
+      for (; element_index != NO_ELEMENT; element_index = next_elements[element_index]) {
+        const auto& build_element = build_partition[element_index];
+        if (build_element.hash != probe_element.hash || build_element.value != probe_element.value) continue;
+
+        build_positions.emplace_back(build_element.row_id);
+        probe_positions.emplace_back(probe_element.row_id);
+      }
+    }
+  }
+
+  JoinHash& _join;
+};
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right,
+                   const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {
+  Assert(scan_type == ScanType::OpEquals, "JoinHash only supports equi-joins");
+}
+
+const std::string JoinHash::name() const { return "JoinHash"; }
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto& left_type = _input_table_left()->column_type(_column_ids.first);
+  const auto& right_type = _input_table_right()->column_type(_column_ids.second);
+  Assert(left_type == right_type, "Join columns have different types");
+
+  const auto implementation = make_unique_by_data_type<BaseJoinHashImpl, JoinHashImpl>(left_type, *this);
+  return implementation->on_execute();
+}
+
+}  // namespace opossum
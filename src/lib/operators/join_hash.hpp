@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinHash performs an equi-join as a radix-partitioned hash join:
+//  1. the join column of both inputs is materialized together with the positions of its values
+//  2. both sides are partitioned by the lowest bits of the hashed values. The number of partitions is chosen so that
+//     every partition of the smaller (build) side fits into the cache.
+//  3. a hash table is built for every partition of the build side and probed with the same partition of the other
+//     (probe) side
+//
+// Materialization and partitioning run in parallel per input chunk, building and probing per partition. Every
+// partition with matches becomes an output chunk. Both join columns need to have the same type.
+class JoinHash : public AbstractJoinOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type = ScanType::OpEquals);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  class BaseJoinHashImpl {
+   public:
+    virtual ~BaseJoinHashImpl() = default;
+    virtual std::shared_ptr<const Table> on_execute() = 0;
+  };
+
+  template <typename T>
+  class JoinHashImpl;
+};
+
+}  // namespace opossum
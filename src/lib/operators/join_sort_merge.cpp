@@ -0,0 +1,258 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// number of ranges per worker that the sorted left side is split into for the merge phase
+constexpr auto MERGE_TASKS_PER_WORKER = size_t{4};
+
+template <typename T>
+class JoinSortMerge::JoinSortMergeImpl : public BaseJoinSortMergeImpl {
+ public:
+  explicit JoinSortMergeImpl(JoinSortMerge& join) : _join(join) {}
+
+  std::shared_ptr<const Table> on_execute() override {
+    const auto left_table = _join._input_table_left();
+    const auto right_table = _join._input_table_right();
+
+    const auto left_elements = _sort(*left_table, _join._column_ids.first);
+    const auto right_elements = _sort(*right_table, _join._column_ids.second);
+
+    const auto left_writer = ReferenceSegmentWriter(left_table);
+    const auto right_writer = ReferenceSegmentWriter(right_table);
+
+    // merge ranges of the left side with the right side in parallel, every range becomes one or more output chunks
+    const auto max_range_count = WorkerPool::get().worker_count() * MERGE_TASKS_PER_WORKER;
+    const auto range_count = std::max(size_t{1}, std::min(left_elements.size(), max_range_count));
+    auto output_table = _join._initialize_output_table();
+    const auto chunk_size = output_table->chunk_size();
+    auto output_chunks = std::vector<std::vector<std::shared_ptr<Chunk>>>(range_count);
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+      tasks.emplace_back([&, range_id]() {
+        const auto range_begin = left_elements.size() * range_id / range_count;
+        const auto range_end = left_elements.size() * (range_id + 1) / range_count;
+
+        auto& chunks = output_chunks[range_id];
+        _merge(left_elements, range_begin, range_end, right_elements, chunk_size,
+               [&](const std::shared_ptr<const PosList>& left_positions,
+                   const std::shared_ptr<const PosList>& right_positions) {
+                 const auto merged_chunks = JoinSortMerge::_make_output_chunks(
+                     left_writer, right_writer, left_positions, right_positions, chunk_size);
+                 chunks.insert(chunks.end(), merged_chunks.cbegin(), merged_chunks.cend());
+               });
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    for (const auto& chunks : output_chunks) {
+      // the first call replaces the existing chunk since it is empty
+      for (const auto& chunk : chunks) output_table->emplace_chunk(chunk);
+    }
+
+    // if nothing matched, a single empty chunk keeps the segments of the result
+    if (output_table->row_count() == 0) {
+      const auto no_positions = std::make_shared<const PosList>();
+      const auto chunks =
+          JoinSortMerge::_make_output_chunks(left_writer, right_writer, no_positions, no_positions, chunk_size);
+      output_table->emplace_chunk(chunks.front());
+    }
+
+    return output_table;
+  }
+
+ protected:
+  // A materialized value of the join column and its position in the input table. Strings are not copied, but
+  // referenced in the value or dictionary segment that holds them, which the input tables keep alive. An element thus
+  // takes 12 bytes for 32-bit values and 16 bytes for 64-bit values and strings.
+  struct Element {
+    using StoredValue = std::conditional_t<std::is_arithmetic_v<T>, T, const T*>;
+
+    Element() = default;
+    Element(const T& value, const RowID& row_id) : row_id(row_id) {
+      if constexpr (std::is_arithmetic_v<T>) {
+        stored_value = value;
+      } else {
+        stored_value = &value;
+      }
+    }
+
+    const T& value() const {
+      if constexpr (std::is_arithmetic_v<T>) {
+        return stored_value;
+      } else {
+        return *stored_value;
+      }
+    }
+
+    StoredValue stored_value;
+    RowID row_id;
+  };
+
+  // Elements are ordered by their values. Ties are broken by their positions, so that the output is deterministic
+  // and a materialized chunk that is ordered by value is also ordered by this comparison.
+  static bool _less(const Element& lhs, const Element& rhs) {
+    if (lhs.value() < rhs.value()) return true;
+    if (rhs.value() < lhs.value()) return false;
+    return lhs.row_id < rhs.row_id;
+  }
+
+  // materializes the given column and returns its elements sorted by _less
+  static std::vector<Element> _sort(const Table& table, const ColumnID column_id) {
+    const auto chunk_count = static_cast<size_t>(table.chunk_count());
+
+    // every chunk is materialized into its own run
+    auto run_begins = std::vector<size_t>{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      run_begins.emplace_back(run_begins.back() + table.get_chunk(chunk_id).size());
+    }
+    auto elements = std::vector<Element>(run_begins.back());
+
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      tasks.emplace_back([&, chunk_id]() {
+        const auto run_begin = elements.begin() + run_begins[chunk_id];
+        const auto run_end = elements.begin() + run_begins[chunk_id + 1];
+        const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+        resolve_segment_values<T>(segment, [&](const size_t position, const T& value) {
+          run_begin[position] = Element{value, RowID{chunk_id, static_cast<ChunkOffset>(position)}};
+        });
+        if (!std::is_sorted(run_begin, run_end, _less)) std::sort(run_begin, run_end, _less);
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    // merge neighboring runs in parallel until a single run is left
+    while (run_begins.size() > 2) {
+      const auto run_count = run_begins.size() - 1;
+      tasks.clear();
+      for (auto run_id = size_t{0}; run_id + 1 < run_count; run_id += 2) {
+        tasks.emplace_back([&, run_id]() {
+          const auto first_begin = elements.begin() + run_begins[run_id];
+          const auto second_begin = elements.begin() + run_begins[run_id + 1];
+          const auto second_end = elements.begin() + run_begins[run_id + 2];
+          if (first_begin == second_begin || second_begin == second_end) return;
+
+          // runs that are already in order do not need to be merged
+          if (!_less(*second_begin, *(second_begin - 1))) return;
+          std::inplace_merge(first_begin, second_begin, second_end, _less);
+        });
+      }
+      WorkerPool::get().execute_and_wait(tasks);
+
+      // every merged pair of runs is now a single run
+      auto merged_run_begins = std::vector<size_t>{};
+      for (auto run_id = size_t{0}; run_id < run_count; run_id += 2) {
+        merged_run_begins.emplace_back(run_begins[run_id]);
+      }
+      merged_run_begins.emplace_back(run_begins.back());
+      run_begins = std::move(merged_run_begins);
+    }
+
+    return elements;
+  }
+
+  // Finds the pairs of positions of the left elements in [range_begin, range_end) and the right elements that satisfy
+  // the join predicate. As both sides are sorted, the right elements that equal a left value form a contiguous range
+  // [lower_bound, upper_bound), which only moves forward for increasing left values. All matches of a left value can
+  // be described relative to that range.
+  //
+  // Inequality joins can match almost every pair, so the pairs are not collected for the whole range. Instead, every
+  // chunk_size pairs, and the remaining pairs at the end, are passed to output_chunk(left_positions, right_positions).
+  template <typename OutputChunk>
+  void _merge(const std::vector<Element>& left_elements, const size_t range_begin, const size_t range_end,
+              const std::vector<Element>& right_elements, const size_t chunk_size,
+              const OutputChunk& output_chunk) const {
+    if (range_begin == range_end || right_elements.empty()) return;
+
+    auto left_positions = std::make_shared<PosList>();
+    auto right_positions = std::make_shared<PosList>();
+    const auto flush = [&]() {
+      output_chunk(left_positions, right_positions);
+      left_positions = std::make_shared<PosList>();
+      right_positions = std::make_shared<PosList>();
+    };
+
+    const auto emit = [&](const Element& left_element, const size_t right_begin, const size_t right_end) {
+      for (auto right_index = right_begin; right_index < right_end; ++right_index) {
+        left_positions->emplace_back(left_element.row_id);
+        right_positions->emplace_back(right_elements[right_index].row_id);
+        if (left_positions->size() == chunk_size) flush();
+      }
+    };
+
+    const auto compare_values = [](const Element& lhs, const Element& rhs) { return lhs.value() < rhs.value(); };
+    const auto right_size = right_elements.size();
+    auto lower_bound = static_cast<size_t>(std::distance(
+        right_elements.cbegin(), std::lower_bound(right_elements.cbegin(), right_elements.cend(),
+                                                  left_elements[range_begin], compare_values)));
+    auto upper_bound = lower_bound;
+
+    for (auto left_index = range_begin; left_index < range_end; ++left_index) {
+      const auto& left_element = left_elements[left_index];
+      while (lower_bound < right_size && right_elements[lower_bound].value() < left_element.value()) ++lower_bound;
+      upper_bound = std::max(upper_bound, lower_bound);
+      while (upper_bound < right_size && !(left_element.value() < right_elements[upper_bound].value())) ++upper_bound;
+
+      switch (_join._scan_type) {
+        case ScanType::OpEquals:
+          emit(left_element, lower_bound, upper_bound);
+          break;
+        case ScanType::OpNotEquals:
+          emit(left_element, 0, lower_bound);
+          emit(left_element, upper_bound, right_size);
+          break;
+        case ScanType::OpLessThan:
+          emit(left_element, upper_bound, right_size);
+          break;
+        case ScanType::OpLessThanEquals:
+          emit(left_element, lower_bound, right_size);
+          break;
+        case ScanType::OpGreaterThan:
+          emit(left_element, 0, lower_bound);
+          break;
+        case ScanType::OpGreaterThanEquals:
+          emit(left_element, 0, upper_bound);
+          break;
+        default:
+          Fail("Unknown scan operator");
+      }
+    }
+
+    if (!left_positions->empty()) flush();
+  }
+
+  JoinSortMerge& _join;
+};
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {}
+
+const std::string JoinSortMerge::name() const { return "JoinSortMerge"; }
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto& left_type = _input_table_left()->column_type(_column_ids.first);
+  const auto& right_type = _input_table_right()->column_type(_column_ids.second);
+  Assert(left_type == right_type, "Join columns have different types");
+
+  const auto implementation = make_unique_by_data_type<BaseJoinSortMergeImpl, JoinSortMergeImpl>(left_type, *this);
+  return implementation->on_execute();
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinSortMerge joins two inputs by sorting both of them on the join column and merging the sorted sides:
+//  1. the join column of each input is materialized into (value, RowID) pairs. The pairs of every chunk form a run,
+//     which is sorted in parallel - unless it is already ordered.
+//  2. the runs are merged pairwise in parallel. Neighboring runs that are already in order are not touched, so an
+//     input that is ordered on the join column is never sorted.
+//  3. the sorted left side is split into ranges, which are merged with the sorted right side in parallel. As both
+//     sides are sorted, the matches of every left value are contiguous ranges of the right side.
+//
+// Besides equi-joins, this supports all other ScanTypes, e.g., left < right. Both join columns need to have the same
+// type.
+//
+// On large inputs, this needs much less memory than JoinHash: the pairs take 12 bytes per row for 32-bit values and 16
+// bytes for 64-bit values and strings, which are referenced instead of copied. They are sorted in place, and no hash
+// tables are built. JoinHash stores a 64-bit hash with every value (24 bytes per row for 32-bit values, plus a copy of
+// every string), holds its materialized elements and their partitions at the same time, and builds a hash table per
+// partition. The output of an inequality join can be quadratic in the input size, so it is written into chunks of at
+// most the output chunk size while merging, and never collected as a whole.
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type = ScanType::OpEquals);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  class BaseJoinSortMergeImpl {
+   public:
+    virtual ~BaseJoinSortMergeImpl() = default;
+    virtual std::shared_ptr<const Table> on_execute() = 0;
+  };
+
+  template <typename T>
+  class JoinSortMergeImpl;
+};
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const size_t row_count)
+    : AbstractOperator(in), _row_count(row_count) {}
+
+size_t Limit::row_count() const { return _row_count; }
+
+const std::string Limit::name() const { return "Limit"; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  // stop as soon as enough rows are taken, the remaining chunks are never touched
+  auto remaining_rows = _row_count;
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count() && remaining_rows > 0; ++chunk_id) {
+    const auto chunk_size = static_cast<size_t>(input_table->get_chunk(chunk_id).size());
+    if (chunk_size == 0) continue;
+
+    const auto taken_rows = std::min(chunk_size, remaining_rows);
+    // the first call replaces the existing chunk since it is empty
+    output_table->emplace_chunk(_limit_chunk(chunk_id, taken_rows));
+    remaining_rows -= taken_rows;
+  }
+
+  // without any rows, a single empty chunk keeps the segments of the result
+  if (output_table->row_count() == 0 && input_table->chunk_count() > 0) {
+    output_table->emplace_chunk(_limit_chunk(ChunkID{0}, 0));
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Chunk> Limit::_limit_chunk(const ChunkID chunk_id, const size_t row_count) const {
+  const auto input_table = _input_table_left();
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  auto output_chunk = std::make_shared<Chunk>();
+  if (input_chunk.column_count() == 0) return output_chunk;
+
+  // we never reference references, so a complete chunk of ReferenceSegments is passed on
+  const auto first_segment = input_chunk.get_segment(ColumnID{0});
+  if (std::dynamic_pointer_cast<const ReferenceSegment>(first_segment) && row_count == input_chunk.size()) {
+    for (auto column_id = ColumnID{0}; column_id < input_chunk.column_count(); ++column_id) {
+      output_chunk->add_segment(input_chunk.get_segment(column_id));
+    }
+    return output_chunk;
+  }
+
+  // otherwise, the first rows of the chunk are referenced
+  auto offsets = std::vector<ChunkOffset>(row_count);
+  std::iota(offsets.begin(), offsets.end(), ChunkOffset{0});
+  ReferenceSegmentWriter::write_subset(*output_chunk, input_table, chunk_id, std::move(offsets));
+
+  return output_chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// Operator that returns the first row_count rows of its input. Only the chunks that contribute rows are looked at,
+// so the cost depends on row_count, not on the size of the input:
+//  - chunks that are taken completely are passed on as they are if they consist of ReferenceSegments, otherwise
+//    they are referenced as a whole
+//  - of the last chunk, only the first rows are referenced
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator> in, const size_t row_count);
+
+  size_t row_count() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // returns a chunk that references the first row_count rows of the input chunk chunk_id
+  std::shared_ptr<Chunk> _limit_chunk(const ChunkID chunk_id, const size_t row_count) const;
+
+  const size_t _row_count;
+};
+
+}  // namespace opossum
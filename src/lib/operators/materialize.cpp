@@ -0,0 +1,72 @@
+#include "materialize.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/pipeline.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator> in, const MaterializeEncoding encoding)
+    : AbstractOperator(in), _encoding(encoding) {}
+
+MaterializeEncoding Materialize::encoding() const { return _encoding; }
+
+bool Materialize::is_pipelineable() const { return true; }
+
+std::shared_ptr<Table> Materialize::initialize_output_table(const std::shared_ptr<const Table>& input_table) {
+  // the initial chunk of the output table gets empty ValueSegments, so that an empty result still has segments
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  return output_table;
+}
+
+const std::string Materialize::name() const { return "Materialize"; }
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  return Pipeline::execute_operators({this}, _input_table_left());
+}
+
+std::shared_ptr<Chunk> Materialize::process_morsel(const std::shared_ptr<const Table>& input_table,
+                                                   const ChunkID chunk_id) const {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  auto output_chunk = std::make_shared<Chunk>();
+
+  for (auto column_id = ColumnID{0}; column_id < input_chunk.column_count(); ++column_id) {
+    const auto segment = input_chunk.get_segment(column_id);
+
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      if (_encoding == MaterializeEncoding::Dictionary &&
+          std::dynamic_pointer_cast<const DictionarySegment<Type>>(segment)) {
+        output_chunk->add_segment(segment);
+        return;
+      }
+
+      auto values = std::vector<Type>(segment->size());
+      resolve_segment_values<Type>(*segment,
+                                   [&](const size_t position, const Type& value) { values[position] = value; });
+      const auto value_segment = std::make_shared<ValueSegment<Type>>(std::move(values));
+
+      if (_encoding == MaterializeEncoding::Dictionary) {
+        output_chunk->add_segment(std::make_shared<DictionarySegment<Type>>(value_segment));
+      } else {
+        output_chunk->add_segment(value_segment);
+      }
+    });
+  }
+
+  return output_chunk;
+}
+
+}  // namespace opossum
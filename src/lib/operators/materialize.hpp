@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// the kind of segments that Materialize produces
+enum class MaterializeEncoding { Value, Dictionary };
+
+// Operator that copies the values of its input into new ValueSegments or DictionarySegments. Reading a
+// ReferenceSegment through operator[] costs a virtual call and an AllTypeVariant per value, and every following
+// operator has to resolve the references again. Expensive intermediate results can thus be materialized once and then
+// be scanned at the speed of a base table.
+//  - every non-empty input chunk becomes an output chunk of the same size. Chunks are materialized in parallel.
+//  - the values of ReferenceSegments are gathered grouped by the chunk they reference (see
+//    reference_segment_resolver.hpp).
+//  - DictionarySegments are passed on as they are if the output is dictionary encoded, since they are immutable.
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator> in,
+                       const MaterializeEncoding encoding = MaterializeEncoding::Value);
+
+  MaterializeEncoding encoding() const;
+
+  bool is_pipelineable() const override;
+  std::shared_ptr<Table> initialize_output_table(const std::shared_ptr<const Table>& input_table) override;
+
+  // returns a chunk that holds the values of the input chunk chunk_id
+  std::shared_ptr<Chunk> process_morsel(const std::shared_ptr<const Table>& input_table,
+                                        const ChunkID chunk_id) const override;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const MaterializeEncoding _encoding;
+};
+
+}  // namespace opossum
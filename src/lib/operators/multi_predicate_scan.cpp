@@ -0,0 +1,276 @@
+#include "multi_predicate_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "runtime_filter.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+#include "utils/with_comparator.hpp"
+
+namespace opossum {
+
+// number of rows that are looked at to estimate the selectivity of a predicate on an uncompressed segment
+constexpr auto SELECTIVITY_SAMPLE_SIZE = size_t{64};
+
+template <typename T>
+class MultiPredicateScan::PredicateImpl : public BasePredicateImpl {
+ public:
+  PredicateImpl(const ScanType scan_type, const AllTypeVariant& value)
+      : _scan_type(scan_type), _value(type_cast<T>(value)) {}
+
+  float estimate_selectivity(const BaseSegment& segment) const override {
+    if (segment.size() == 0) return 0.0f;
+
+    // the dictionary tells us how many distinct values qualify - assuming that the values are uniformly distributed,
+    // this is also the fraction of qualifying rows
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      const auto range = _matching_value_ids(*dictionary_segment);
+      const auto matching_share =
+          static_cast<float>(range.end - range.begin) / static_cast<float>(dictionary_segment->unique_values_count());
+      return range.inverted ? 1.0f - matching_share : matching_share;
+    }
+
+    // otherwise, evaluate the predicate on a sample of evenly distributed rows
+    const auto sample_size = std::min(SELECTIVITY_SAMPLE_SIZE, segment.size());
+    const auto step = segment.size() / sample_size;
+    auto matches = size_t{0};
+    with_comparator(_scan_type, [&](auto comparator) {
+      _sample_values(segment, sample_size, step, [&](const T& value) { matches += comparator(value, _value); });
+    });
+    return static_cast<float>(matches) / static_cast<float>(sample_size);
+  }
+
+  size_t refine(const BaseSegment& segment, std::vector<bool>& selection) const override {
+    DebugAssert(segment.size() == selection.size(), "Selection does not match the segment");
+    auto remaining_rows = size_t{0};
+
+    if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+      const auto& values = value_segment->values();
+      with_comparator(_scan_type, [&](auto comparator) {
+        for (ChunkOffset chunk_offset{0}; chunk_offset < values.size(); ++chunk_offset) {
+          if (!selection[chunk_offset]) continue;
+          const auto qualifies = comparator(values[chunk_offset], _value);
+          selection[chunk_offset] = qualifies;
+          remaining_rows += qualifies;
+        }
+      });
+    } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      // compare value ids instead of values, the dictionary lookup happens only once
+      const auto range = _matching_value_ids(*dictionary_segment);
+      const auto range_begin = static_cast<ValueID::base_type>(range.begin);
+      const auto range_end = static_cast<ValueID::base_type>(range.end);
+      resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+        for (ChunkOffset chunk_offset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+          if (!selection[chunk_offset]) continue;
+          const auto value_id = value_ids[chunk_offset];
+          const auto qualifies = (value_id >= range_begin && value_id < range_end) != range.inverted;
+          selection[chunk_offset] = qualifies;
+          remaining_rows += qualifies;
+        }
+      });
+    } else {
+      const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+      DebugAssert(reference_segment, "Segment is neither a value, a dictionary, nor a reference segment");
+      with_comparator(_scan_type, [&](auto comparator) {
+        resolve_reference_segment<T>(*reference_segment, [&](const size_t position, const T& value) {
+          if (!selection[position]) return;
+          const auto qualifies = comparator(value, _value);
+          selection[position] = qualifies;
+          remaining_rows += qualifies;
+        });
+      });
+    }
+
+    return remaining_rows;
+  }
+
+ protected:
+  // A row of a dictionary segment satisfies the predicate iff its value id is in [begin, end) - or, if inverted is
+  // set, iff it is not
+  struct ValueIDRange {
+    ValueID begin;
+    ValueID end;
+    bool inverted;
+  };
+
+  ValueIDRange _matching_value_ids(const DictionarySegment<T>& segment) const {
+    const auto unique_values_count = ValueID{static_cast<uint32_t>(segment.unique_values_count())};
+    auto lower_bound = segment.lower_bound(_value);
+    auto upper_bound = segment.upper_bound(_value);
+    if (lower_bound == INVALID_VALUE_ID) lower_bound = unique_values_count;
+    if (upper_bound == INVALID_VALUE_ID) upper_bound = unique_values_count;
+
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return {lower_bound, upper_bound, false};
+      case ScanType::OpNotEquals:
+        return {lower_bound, upper_bound, true};
+      case ScanType::OpLessThan:
+        return {ValueID{0}, lower_bound, false};
+      case ScanType::OpLessThanEquals:
+        return {ValueID{0}, upper_bound, false};
+      case ScanType::OpGreaterThan:
+        return {upper_bound, unique_values_count, false};
+      case ScanType::OpGreaterThanEquals:
+        return {lower_bound, unique_values_count, false};
+      default:
+        Fail("Unknown scan operator");
+        return {};
+    }
+  }
+
+  // calls functor(value) for the rows 0, step, ..., (sample_size - 1) * step of a value, dictionary or reference
+  // segment. The type of the segment is resolved once, not once per row.
+  template <typename Functor>
+  void _sample_values(const BaseSegment& segment, const size_t sample_size, const size_t step,
+                      const Functor& functor) const {
+    if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+      const auto& values = value_segment->values();
+      for (auto sample_index = size_t{0}; sample_index < sample_size; ++sample_index) {
+        functor(values[sample_index * step]);
+      }
+      return;
+    }
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      for (auto sample_index = size_t{0}; sample_index < sample_size; ++sample_index) {
+        functor(dictionary_segment->get(static_cast<ChunkOffset>(sample_index * step)));
+      }
+      return;
+    }
+
+    // the sampled positions form a small reference segment, which is resolved once per referenced chunk. Its
+    // positions are taken from the ChunkPosList directly if there is one, so that it is not materialized.
+    const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+    DebugAssert(reference_segment, "Segment is neither a value, a dictionary, nor a reference segment");
+    const auto& referenced_table = reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+    const auto sample_segment = [&]() {
+      if (const auto chunk_pos_list = reference_segment->chunk_pos_list()) {
+        auto offsets = std::vector<ChunkOffset>{};
+        offsets.reserve(sample_size);
+        for (auto sample_index = size_t{0}; sample_index < sample_size; ++sample_index) {
+          offsets.emplace_back((*chunk_pos_list)[sample_index * step]);
+        }
+        const auto sample_positions = std::make_shared<const ChunkPosList>(
+            chunk_pos_list->chunk_id(), chunk_pos_list->chunk_size(), std::move(offsets));
+        return ReferenceSegment{referenced_table, referenced_column_id, sample_positions};
+      }
+
+      const auto& pos_list = *reference_segment->pos_list();
+      auto sample_positions = std::make_shared<PosList>();
+      sample_positions->reserve(sample_size);
+      for (auto sample_index = size_t{0}; sample_index < sample_size; ++sample_index) {
+        sample_positions->emplace_back(pos_list[sample_index * step]);
+      }
+      if (pos_list.references_single_chunk()) sample_positions->guarantee_single_chunk();
+      return ReferenceSegment{referenced_table, referenced_column_id, sample_positions};
+    };
+    resolve_reference_segment<T>(sample_segment(), [&](const size_t, const T& value) { functor(value); });
+  }
+
+  const ScanType _scan_type;
+  const T _value;
+};
+
+MultiPredicateScan::MultiPredicateScan(const std::shared_ptr<const AbstractOperator> in,
+                                       std::vector<ScanPredicate> predicates)
+    : AbstractOperator(in), _predicates(std::move(predicates)) {
+  Assert(!_predicates.empty(), "MultiPredicateScan needs at least one predicate");
+}
+
+const std::vector<ScanPredicate>& MultiPredicateScan::predicates() const { return _predicates; }
+
+void MultiPredicateScan::set_runtime_filter(const std::shared_ptr<const AbstractOperator>& build_input,
+                                            const ColumnID build_column_id, const ColumnID column_id) {
+  Assert(!_output, "Runtime filters need to be set before the scan is executed");
+  _input_right = build_input;
+  _runtime_filter_build_column_id = build_column_id;
+  _runtime_filter_column_id = column_id;
+}
+
+const std::string MultiPredicateScan::name() const { return "MultiPredicateScan"; }
+
+std::shared_ptr<const Table> MultiPredicateScan::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto predicate_impls = std::vector<std::unique_ptr<BasePredicateImpl>>{};
+  for (const auto& predicate : _predicates) {
+    const auto& column_type = input_table->column_type(predicate.column_id);
+    predicate_impls.emplace_back(
+        make_unique_by_data_type<BasePredicateImpl, PredicateImpl>(column_type, predicate.scan_type, predicate.value));
+  }
+
+  auto runtime_filter = std::unique_ptr<const RuntimeFilter>{};
+  if (_input_right) {
+    runtime_filter = std::make_unique<RuntimeFilter>(*_input_table_right(), _runtime_filter_build_column_id);
+    Assert(runtime_filter->data_type() == input_table->column_type(_runtime_filter_column_id),
+           "Runtime filter and column have differing data types");
+  }
+
+  auto result_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
+    result_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+    const auto trace_scope = Tracer::Scope{"scan", "scan_chunk", "chunk_id", chunk_id};
+
+    // order the predicates so that the most selective one is evaluated first
+    auto evaluation_order = std::vector<std::pair<float, size_t>>{};
+    for (auto predicate_index = size_t{0}; predicate_index < _predicates.size(); ++predicate_index) {
+      const auto& segment = *chunk.get_segment(_predicates[predicate_index].column_id);
+      evaluation_order.emplace_back(predicate_impls[predicate_index]->estimate_selectivity(segment), predicate_index);
+    }
+    std::stable_sort(evaluation_order.begin(), evaluation_order.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    auto selection = std::vector<bool>(chunk.size(), true);
+    for (const auto& [selectivity, predicate_index] : evaluation_order) {
+      const auto& segment = *chunk.get_segment(_predicates[predicate_index].column_id);
+      const auto remaining_rows = predicate_impls[predicate_index]->refine(segment, selection);
+
+      // no need to evaluate further predicates if no row is left
+      if (remaining_rows == 0) break;
+    }
+
+    auto offsets = std::vector<ChunkOffset>{};
+    for (ChunkOffset chunk_offset{0}; chunk_offset < selection.size(); ++chunk_offset) {
+      if (selection[chunk_offset]) offsets.emplace_back(chunk_offset);
+    }
+    if (runtime_filter) runtime_filter->filter(*chunk.get_segment(_runtime_filter_column_id), offsets);
+    if (offsets.empty()) continue;
+
+    // Every input chunk with matches becomes an output chunk, like in TableScan. Its positions reference a single
+    // chunk, and the original rows if the input consists of reference segments. The first call replaces the existing
+    // chunk since it is empty.
+    auto output_chunk = std::make_shared<Chunk>();
+    ReferenceSegmentWriter::write_subset(*output_chunk, input_table, chunk_id, std::move(offsets));
+    result_table->emplace_chunk(output_chunk);
+  }
+
+  // if no rows are left, a single empty chunk keeps the segments of the result
+  if (result_table->row_count() == 0) {
+    auto output_chunk = std::make_shared<Chunk>();
+    ReferenceSegmentWriter(input_table).write(*output_chunk, std::make_shared<const PosList>());
+    result_table->emplace_chunk(output_chunk);
+  }
+
+  return result_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// A single predicate of a MultiPredicateScan: <column> <scan_type> <value>
+struct ScanPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant value;
+};
+
+// Operator that filters its input by a conjunction of predicates in a single pass.
+//
+// Chaining TableScans materializes a PosList and a new table for every predicate, and every later scan has to go
+// through ReferenceSegments. Instead, the MultiPredicateScan evaluates all predicates chunk by chunk on the input
+// segments and refines a selection bitmap. Per chunk, the predicates are ordered by their estimated selectivity so
+// that the most selective one reduces the number of candidates first. Once no row of a chunk qualifies anymore, the
+// remaining predicates are skipped. Only a single PosList is emitted.
+class MultiPredicateScan : public AbstractOperator {
+ public:
+  MultiPredicateScan(const std::shared_ptr<const AbstractOperator> in, std::vector<ScanPredicate> predicates);
+
+  const std::vector<ScanPredicate>& predicates() const;
+
+  // like TableScan::set_runtime_filter, drops most rows whose value in column_id does not occur in the column
+  // build_column_id of the output of build_input, which becomes the right input. Call this before execute().
+  void set_runtime_filter(const std::shared_ptr<const AbstractOperator>& build_input, const ColumnID build_column_id,
+                          const ColumnID column_id);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ScanPredicate> _predicates;
+
+  ColumnID _runtime_filter_build_column_id{0};
+  ColumnID _runtime_filter_column_id{0};
+
+  // Evaluates one predicate. The implementation is templated by the data type of the predicate's column, so
+  // predicates on columns of different types can be combined.
+  class BasePredicateImpl {
+   public:
+    virtual ~BasePredicateImpl() = default;
+
+    // returns the estimated fraction of rows of the segment that satisfy the predicate
+    virtual float estimate_selectivity(const BaseSegment& segment) const = 0;
+
+    // unsets every entry of selection whose row does not satisfy the predicate, returns the number of rows left
+    virtual size_t refine(const BaseSegment& segment, std::vector<bool>& selection) const = 0;
+  };
+
+  template <typename T>
+  class PredicateImpl;
+};
+
+}  // namespace opossum
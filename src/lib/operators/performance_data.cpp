@@ -0,0 +1,55 @@
+#include "performance_data.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace opossum {
+
+namespace {
+
+// prints the value with three significant digits and the largest unit that keeps it at least 1
+void print_scaled(std::ostream& stream, const double value, const char* const units[], const size_t unit_count,
+                  const double factor) {
+  auto scaled_value = value;
+  auto unit_index = size_t{0};
+  while (scaled_value >= factor && unit_index + 1 < unit_count) {
+    scaled_value /= factor;
+    ++unit_index;
+  }
+  const auto precision = unit_index == 0 ? 0 : scaled_value < 10 ? 2 : scaled_value < 100 ? 1 : 0;
+  stream << std::fixed << std::setprecision(precision) << scaled_value << " " << units[unit_index];
+}
+
+}  // namespace
+
+std::string PerformanceData::to_string() const {
+  if (!executed) return "not executed";
+
+  static const char* const duration_units[] = {"ns", "us", "ms", "s"};
+  static const char* const byte_units[] = {"B", "KB", "MB", "GB", "TB"};
+
+  auto stream = std::stringstream{};
+  if (pipelined && walltime.count() == 0) {
+    stream << "pipelined";
+  } else {
+    print_scaled(stream, static_cast<double>(walltime.count()), duration_units, 4, 1000);
+    stream << " (cpu ";
+    print_scaled(stream, static_cast<double>(cpu_time.count()), duration_units, 4, 1000);
+    stream << ")";
+  }
+  stream << ", " << input_row_count << " -> " << output_row_count << " rows, " << input_chunk_count << " -> "
+         << output_chunk_count << " chunks";
+  if (output_bytes > 0) {
+    stream << ", ";
+    print_scaled(stream, static_cast<double>(output_bytes), byte_units, 5, 1024);
+  }
+
+  const auto row_count = input_row_count > 0 ? input_row_count : output_row_count;
+  const auto hardware_counter_string = hardware_counters.to_string(row_count);
+  if (!hardware_counter_string.empty()) stream << ", " << hardware_counter_string;
+  return stream.str();
+}
+
+}  // namespace opossum
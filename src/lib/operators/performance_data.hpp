@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+// Statistics about the execution of an operator, which are recorded by AbstractOperator::execute and the Pipeline.
+// Row and chunk counts refer to the tables that the operator consumes and produces.
+struct PerformanceData {
+  // whether the operator has been executed, all other members are only meaningful if it has
+  bool executed = false;
+
+  // Whether the operator was fused with others into a Pipeline. Only the last operator of a pipeline keeps its output,
+  // so it gets the times and the output size of the entire pipeline. For the others, only the rows and (non-empty)
+  // chunks that they passed on are known.
+  bool pipelined = false;
+
+  std::chrono::nanoseconds walltime{0};
+
+  // CPU time of all threads that worked for the operator, see CpuTimeAccount
+  std::chrono::nanoseconds cpu_time{0};
+
+  uint64_t input_row_count = 0;
+  uint64_t input_chunk_count = 0;
+  uint64_t output_row_count = 0;
+  uint64_t output_chunk_count = 0;
+
+  // estimated memory usage of the output table, see Table::estimate_memory_usage
+  uint64_t output_bytes = 0;
+
+  // collected like the CPU time if HardwareCounters are enabled, otherwise missing
+  HardwareCounterValues hardware_counters;
+
+  // Returns a single line summary, e.g., "1.23 ms (cpu 4.56 ms), 1000 -> 10 rows, 10 -> 1 chunks, 2.34 KB". Hardware
+  // counters are given per input row (or output row for operators without input).
+  std::string to_string() const;
+};
+
+}  // namespace opossum
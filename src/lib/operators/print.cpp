@@ -23,6 +23,8 @@ void Print::print(std::shared_ptr<const Table> table, std::ostream& out) {
   Print(table_wrapper, out).execute();
 }
 
+const std::string Print::name() const { return "Print"; }
+
 std::shared_ptr<const Table> Print::_on_execute() {
   PerformanceWarningDisabler pwd;
 
@@ -70,6 +72,8 @@ std::shared_ptr<const Table> Print::_on_execute() {
 // number of characters in the printed representation of each column
 // `min` and `max` can be used to limit the width of the columns - however, every column fits at least the column's name
 std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, std::shared_ptr<const Table> t) const {
+  PerformanceWarningDisabler pwd;
+
   std::vector<uint16_t> widths(t->column_count());
   // calculate the length of the column name
   for (ColumnID column_id{0}; column_id < t->column_count(); ++column_id) {
@@ -0,0 +1,100 @@
+#include "projection.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/column_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "scheduler/pipeline.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       std::vector<std::shared_ptr<const AbstractExpression>> expressions)
+    : AbstractOperator(in), _expressions(std::move(expressions)) {
+  Assert(!_expressions.empty(), "Projection needs at least one expression");
+}
+
+const std::vector<std::shared_ptr<const AbstractExpression>>& Projection::expressions() const { return _expressions; }
+
+bool Projection::is_pipelineable() const { return true; }
+
+std::shared_ptr<Table> Projection::initialize_output_table(const std::shared_ptr<const Table>& input_table) {
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  const auto& output_column_names = output_table->column_names();
+  for (const auto& expression : _expressions) {
+    // an expression that is projected more than once gets a numbered name, e.g., a, a_2
+    const auto description = expression->description(*input_table);
+    auto column_name = description;
+    for (auto suffix = 2; std::find(output_column_names.cbegin(), output_column_names.cend(), column_name) !=
+                          output_column_names.cend();
+         ++suffix) {
+      column_name = description + "_" + std::to_string(suffix);
+    }
+    output_table->add_column_definition(column_name, expression->data_type(*input_table));
+  }
+
+  // Every input chunk gets a chunk in the computed table, whose segments are added when the input chunk is processed.
+  // Thus, all output chunks reference the same table, which is needed to build PosLists of the output.
+  _computed_table = std::make_shared<Table>(input_table->chunk_size());
+  for (const auto& expression : _expressions) {
+    if (expression->type() == ExpressionType::Column) continue;
+    const auto column_name = std::to_string(_computed_table->column_count());
+    _computed_table->add_column_definition(column_name, expression->data_type(*input_table));
+  }
+  _computed_table->create_empty_chunks(input_table->chunk_count());
+
+  return output_table;
+}
+
+std::shared_ptr<Chunk> Projection::process_morsel(const std::shared_ptr<const Table>& input_table,
+                                                  const ChunkID chunk_id) const {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  const auto evaluator = ExpressionEvaluator{input_table, chunk_id};
+  auto& computed_chunk = _computed_table->get_chunk(chunk_id);
+
+  // the positions of all rows of the input chunk and of the computed chunk, created on first use
+  auto input_positions = std::shared_ptr<const ChunkPosList>{};
+  auto computed_positions = std::shared_ptr<const ChunkPosList>{};
+
+  auto output_chunk = std::make_shared<Chunk>();
+  for (const auto& expression : _expressions) {
+    if (expression->type() != ExpressionType::Column) {
+      const auto computed_column_id = ColumnID{computed_chunk.column_count()};
+      computed_chunk.add_segment(evaluator.evaluate_to_segment(*expression));
+
+      if (!computed_positions) computed_positions = ChunkPosList::make_entire_chunk(chunk_id, input_chunk.size());
+      output_chunk->add_segment(
+          std::make_shared<ReferenceSegment>(_computed_table, computed_column_id, computed_positions));
+      continue;
+    }
+
+    // we never reference references, so the ReferenceSegments of a reference input are passed on
+    const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id();
+    const auto segment = input_chunk.get_segment(column_id);
+    if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      output_chunk->add_segment(segment);
+      continue;
+    }
+
+    if (!input_positions) input_positions = ChunkPosList::make_entire_chunk(chunk_id, input_chunk.size());
+    output_chunk->add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, input_positions));
+  }
+
+  return output_chunk;
+}
+
+const std::string Projection::name() const { return "Projection"; }
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  return Pipeline::execute_operators({this}, _input_table_left());
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that computes one output column per expression, e.g., a * b or a > 5. The columns are named after the
+// descriptions of the expressions; duplicate names are numbered (a, a_2). Columns that are simply selected
+// (ColumnExpressions) are not copied: the ReferenceSegments of a reference input are passed on, data segments are
+// referenced with a ChunkPosList that covers the entire chunk. Computed columns are evaluated per chunk in parallel by
+// the ExpressionEvaluator into new ValueSegments. So that the output still consists of ReferenceSegments only, these
+// are stored in an internal table and referenced as well.
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in,
+             std::vector<std::shared_ptr<const AbstractExpression>> expressions);
+
+  const std::vector<std::shared_ptr<const AbstractExpression>>& expressions() const;
+
+  bool is_pipelineable() const override;
+  std::shared_ptr<Table> initialize_output_table(const std::shared_ptr<const Table>& input_table) override;
+  std::shared_ptr<Chunk> process_morsel(const std::shared_ptr<const Table>& input_table,
+                                        const ChunkID chunk_id) const override;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<std::shared_ptr<const AbstractExpression>> _expressions;
+
+  // the values of the computed columns, which the output references
+  std::shared_ptr<Table> _computed_table;
+};
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include "runtime_filter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of bits per inserted value and number of bits that are set per value
+constexpr auto BLOOM_FILTER_BITS_PER_VALUE = size_t{16};
+constexpr auto BLOOM_FILTER_PROBES = uint64_t{3};
+
+// removes the offsets for which keep(offset) returns false
+template <typename Keep>
+void erase_offsets(std::vector<ChunkOffset>& offsets, const Keep& keep) {
+  offsets.erase(std::remove_if(offsets.begin(), offsets.end(), [&](const ChunkOffset offset) { return !keep(offset); }),
+                offsets.end());
+}
+
+}  // namespace
+
+RuntimeFilter::RuntimeFilter(const Table& table, const ColumnID column_id) : _data_type(table.column_type(column_id)) {
+  resolve_data_type(_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    // size the filter for the number of values that are inserted
+    auto value_count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+      const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment);
+      value_count += dictionary_segment ? dictionary_segment->unique_values_count() : segment.size();
+    }
+
+    auto bit_count = size_t{64};
+    while (bit_count < value_count * BLOOM_FILTER_BITS_PER_VALUE) bit_count <<= 1;
+    _bits.resize(bit_count / 64);
+    _bit_mask = bit_count - 1;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+      if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+        for (const auto& value : *dictionary_segment->dictionary()) _insert(_hash(value));
+        continue;
+      }
+      resolve_segment_values<Type>(segment, [&](const size_t, const Type& value) { _insert(_hash(value)); });
+    }
+  });
+}
+
+const std::string& RuntimeFilter::data_type() const { return _data_type; }
+
+void RuntimeFilter::filter(const BaseSegment& segment, std::vector<ChunkOffset>& offsets) const {
+  if (offsets.empty()) return;
+
+  resolve_data_type(_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    if (const auto value_segment = dynamic_cast<const ValueSegment<Type>*>(&segment)) {
+      const auto& values = value_segment->values();
+      erase_offsets(offsets, [&](const ChunkOffset offset) { return may_contain(values[offset]); });
+      return;
+    }
+
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+        // with fewer rows than dictionary entries, checking the rows directly is cheaper
+        if (offsets.size() < dictionary.size()) {
+          erase_offsets(offsets, [&](const ChunkOffset offset) { return may_contain(dictionary[value_ids[offset]]); });
+          return;
+        }
+
+        auto contained_value_ids = std::vector<bool>(dictionary.size());
+        for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+          contained_value_ids[value_id] = may_contain(dictionary[value_id]);
+        }
+        erase_offsets(offsets, [&](const ChunkOffset offset) { return contained_value_ids[value_ids[offset]]; });
+      });
+      return;
+    }
+
+    const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+    Assert(reference_segment, "Segment and runtime filter have differing data types");
+    auto contained_positions = std::vector<bool>(reference_segment->size());
+    resolve_reference_segment<Type>(*reference_segment, [&](const size_t position, const Type& value) {
+      contained_positions[position] = may_contain(value);
+    });
+    erase_offsets(offsets, [&](const ChunkOffset offset) { return contained_positions[offset]; });
+  });
+}
+
+void RuntimeFilter::_insert(const uint64_t hash) {
+  // double hashing: the probes are derived from the two halves of the hash
+  const auto step = (hash >> 32) | 1;
+  for (auto probe = uint64_t{0}; probe < BLOOM_FILTER_PROBES; ++probe) {
+    const auto bit = (hash + probe * step) & _bit_mask;
+    _bits[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+}
+
+bool RuntimeFilter::_may_contain(const uint64_t hash) const {
+  const auto step = (hash >> 32) | 1;
+  for (auto probe = uint64_t{0}; probe < BLOOM_FILTER_PROBES; ++probe) {
+    const auto bit = (hash + probe * step) & _bit_mask;
+    if (!(_bits[bit / 64] & (uint64_t{1} << (bit % 64)))) return false;
+  }
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+// A RuntimeFilter is a Bloom filter over the values of a column, usually the join column of the build side of a join. A
+// scan on the probe side can use it to drop rows that cannot find a join partner before they reach the join (see
+// TableScan::set_runtime_filter and MultiPredicateScan::set_runtime_filter). Values that are in the column are always
+// found, other values are found with a false positive rate of about 0.5% (16 bits per value, three probes).
+//
+// For DictionarySegments of the build side, only the dictionary is inserted. On the probe side, every entry of a
+// dictionary is checked once, which gives a bitmap over its value ids that the rows are then filtered with.
+class RuntimeFilter : private Noncopyable {
+ public:
+  // creates a filter over the values of the given column
+  RuntimeFilter(const Table& table, const ColumnID column_id);
+
+  // returns the data type of the column the filter was built from
+  const std::string& data_type() const;
+
+  // returns false if the value is certainly not in the column, T needs to be the type of the column
+  template <typename T>
+  bool may_contain(const T& value) const {
+    return _may_contain(_hash(value));
+  }
+
+  // removes the offsets of the rows of segment whose values are certainly not in the column. The segment needs to be
+  // of the same data type as the column.
+  void filter(const BaseSegment& segment, std::vector<ChunkOffset>& offsets) const;
+
+ protected:
+  template <typename T>
+  static uint64_t _hash(const T& value) {
+    // std::hash is the identity for integers, so the bits are mixed (finalizer of MurmurHash3)
+    auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  void _insert(const uint64_t hash);
+  bool _may_contain(const uint64_t hash) const;
+
+  const std::string _data_type;
+  std::vector<uint64_t> _bits;
+
+  // number of bits - 1, the number of bits is a power of two
+  uint64_t _bit_mask = 0;
+};
+
+}  // namespace opossum
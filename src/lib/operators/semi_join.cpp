@@ -0,0 +1,128 @@
+#include "semi_join.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// number of tasks per worker that the chunks of the left input are distributed to
+constexpr auto SEMI_JOIN_TASKS_PER_WORKER = size_t{4};
+
+SemiJoin::SemiJoin(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const std::pair<ColumnID, ColumnID>& column_ids,
+                   const SemiJoinMode mode)
+    : AbstractOperator(left, right), _column_ids(column_ids), _mode(mode) {
+  Assert(left && right, "Joins need two inputs");
+}
+
+const std::pair<ColumnID, ColumnID>& SemiJoin::column_ids() const { return _column_ids; }
+
+SemiJoinMode SemiJoin::mode() const { return _mode; }
+
+const std::string SemiJoin::name() const { return "SemiJoin"; }
+
+std::shared_ptr<const Table> SemiJoin::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto& column_type = left_table->column_type(_column_ids.first);
+  Assert(column_type == right_table->column_type(_column_ids.second), "Join columns have differing data types");
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < left_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+
+  const auto chunk_count = static_cast<size_t>(left_table->chunk_count());
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  // a left row is kept if finding a partner is what the mode asks for
+  const auto keep_found = _mode == SemiJoinMode::Semi;
+
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    // build
+    auto right_values = std::unordered_set<Type>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < right_table->chunk_count(); ++chunk_id) {
+      const auto& segment = *right_table->get_chunk(chunk_id).get_segment(_column_ids.second);
+      if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+        right_values.insert(dictionary_segment->dictionary()->cbegin(), dictionary_segment->dictionary()->cend());
+        continue;
+      }
+      resolve_segment_values<Type>(segment, [&](const size_t, const Type& value) { right_values.emplace(value); });
+    }
+
+    // probe, every task only writes the output chunks of its own chunks
+    const auto keep = [&](const Type& value) { return (right_values.count(value) > 0) == keep_found; };
+    const auto task_count =
+        std::max(size_t{1}, std::min(chunk_count, WorkerPool::get().worker_count() * SEMI_JOIN_TASKS_PER_WORKER));
+
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back([&, task_id]() {
+        const auto first_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * task_id / task_count)};
+        const auto end_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * (task_id + 1) / task_count)};
+        for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+          const auto& segment = *left_table->get_chunk(chunk_id).get_segment(_column_ids.first);
+          auto offsets = std::vector<ChunkOffset>{};
+
+          if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+            const auto& dictionary = *dictionary_segment->dictionary();
+            auto kept_value_ids = std::vector<bool>(dictionary.size());
+            for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+              kept_value_ids[value_id] = keep(dictionary[value_id]);
+            }
+            resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+                if (kept_value_ids[value_ids[chunk_offset]]) offsets.emplace_back(chunk_offset);
+              }
+            });
+          } else {
+            // reference segments are not necessarily visited in order
+            auto kept_positions = std::vector<bool>(segment.size());
+            resolve_segment_values<Type>(segment, [&](const size_t position, const Type& value) {
+              kept_positions[position] = keep(value);
+            });
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < kept_positions.size(); ++chunk_offset) {
+              if (kept_positions[chunk_offset]) offsets.emplace_back(chunk_offset);
+            }
+          }
+
+          if (offsets.empty()) continue;
+          output_chunks[chunk_id] = std::make_shared<Chunk>();
+          ReferenceSegmentWriter::write_subset(*output_chunks[chunk_id], left_table, chunk_id, std::move(offsets));
+        }
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+  });
+
+  // the first call replaces the existing chunk since it is empty
+  for (const auto& output_chunk : output_chunks) {
+    if (output_chunk) output_table->emplace_chunk(output_chunk);
+  }
+
+  // if no row is left, a single empty chunk keeps the segments of the result
+  if (output_table->row_count() == 0 && chunk_count > 0) {
+    auto chunk = std::make_shared<Chunk>();
+    ReferenceSegmentWriter::write_subset(*chunk, left_table, ChunkID{0}, {});
+    output_table->emplace_chunk(chunk);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// whether a SemiJoin keeps the rows with (Semi) or without (Anti) a join partner
+enum class SemiJoinMode { Semi, Anti };
+
+// Operator that returns the rows of its left input for which the right input has (or, as an anti join, has no) row
+// with left[column_ids.first] = right[column_ids.second]. Unlike the other joins, every left row is returned at most
+// once and the output only has the columns of the left input, e.g., for EXISTS / NOT EXISTS subqueries.
+//
+// The values of the right column are collected in a hash set, only the dictionary of DictionarySegments is inserted.
+// The chunks of the left input are probed in parallel, the entries of a dictionary are probed once each. Both columns
+// need to have the same type. The output consists of ReferenceSegments.
+class SemiJoin : public AbstractOperator {
+ public:
+  SemiJoin(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids, const SemiJoinMode mode = SemiJoinMode::Semi);
+
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  SemiJoinMode mode() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const SemiJoinMode _mode;
+};
+
+}  // namespace opossum
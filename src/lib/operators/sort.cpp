@@ -0,0 +1,380 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// number of bits that the radix sort processes per pass
+constexpr auto RADIX_BITS = size_t{8};
+
+// minimum number of rows that a task of the radix sort processes, smaller inputs are sorted by fewer tasks
+constexpr auto MIN_ROWS_PER_SORT_TASK = size_t{1} << 16;
+
+namespace {
+
+// The radix keys of numbers are unsigned integers with the same order. For signed integers, the sign bit is flipped.
+// For floating point numbers, all bits of negative numbers are flipped (as their order is reversed) and only the
+// sign bit of positive ones. -0.0 is normalized so that it equals 0.0, which keeps the sort stable for them.
+uint32_t radix_key(const int32_t value) { return static_cast<uint32_t>(value) ^ (uint32_t{1} << 31); }
+
+uint64_t radix_key(const int64_t value) { return static_cast<uint64_t>(value) ^ (uint64_t{1} << 63); }
+
+uint32_t radix_key(const float value) {
+  const auto normalized_value = value == 0.0f ? 0.0f : value;
+  auto bits = uint32_t{0};
+  std::memcpy(&bits, &normalized_value, sizeof(bits));
+  return (bits >> 31) ? ~bits : bits | (uint32_t{1} << 31);
+}
+
+uint64_t radix_key(const double value) {
+  const auto normalized_value = value == 0.0 ? 0.0 : value;
+  auto bits = uint64_t{0};
+  std::memcpy(&bits, &normalized_value, sizeof(bits));
+  return (bits >> 63) ? ~bits : bits | (uint64_t{1} << 63);
+}
+
+template <typename Key>
+struct RadixElement {
+  Key key;
+  RowID row_id;
+};
+
+// Sorts the elements by their keys with a stable LSD radix sort. In every pass, each task builds the histogram of the
+// current digit for its range of elements. The histograms are turned into write offsets, so that the tasks can
+// scatter their elements in parallel without synchronization.
+template <typename Key>
+void radix_sort(std::vector<RadixElement<Key>>& elements) {
+  constexpr auto RADIX_SIZE = size_t{1} << RADIX_BITS;
+  const auto row_count = elements.size();
+  if (row_count < 2) return;
+
+  const auto task_count =
+      std::max(size_t{1}, std::min(WorkerPool::get().worker_count(), row_count / MIN_ROWS_PER_SORT_TASK));
+  const auto range_begin = [&](const size_t task_id) { return row_count * task_id / task_count; };
+
+  auto buffer = std::vector<RadixElement<Key>>(row_count);
+  auto histograms = std::vector<std::array<size_t, RADIX_SIZE>>(task_count);
+  auto tasks = std::vector<std::function<void()>>{};
+
+  for (auto shift = size_t{0}; shift < sizeof(Key) * CHAR_BIT; shift += RADIX_BITS) {
+    const auto digit = [shift](const Key key) { return static_cast<size_t>(key >> shift) & (RADIX_SIZE - 1); };
+
+    tasks.clear();
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back([&, task_id]() {
+        auto& histogram = histograms[task_id];
+        histogram.fill(0);
+        for (auto index = range_begin(task_id); index < range_begin(task_id + 1); ++index) {
+          ++histogram[digit(elements[index].key)];
+        }
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    // if all keys share the digit, the pass would not change the order
+    const auto first_digit = digit(elements.front().key);
+    auto first_digit_count = size_t{0};
+    for (const auto& histogram : histograms) first_digit_count += histogram[first_digit];
+    if (first_digit_count == row_count) continue;
+
+    auto write_offset = size_t{0};
+    for (auto digit_value = size_t{0}; digit_value < RADIX_SIZE; ++digit_value) {
+      for (auto& histogram : histograms) {
+        const auto count = histogram[digit_value];
+        histogram[digit_value] = write_offset;
+        write_offset += count;
+      }
+    }
+
+    tasks.clear();
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back([&, task_id]() {
+        auto& write_offsets = histograms[task_id];
+        for (auto index = range_begin(task_id); index < range_begin(task_id + 1); ++index) {
+          buffer[write_offsets[digit(elements[index].key)]++] = elements[index];
+        }
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+    elements.swap(buffer);
+  }
+}
+
+}  // namespace
+
+template <typename T>
+class Sort::SortImpl : public BaseSortImpl {
+ public:
+  explicit SortImpl(Sort& sort) : _sort(sort), _descending(sort._order_by_mode == OrderByMode::Descending) {}
+
+  std::shared_ptr<PosList> sorted_positions() override {
+    const auto& table = *_sort._input_table_left();
+
+    if (const auto dictionary_segment = _single_dictionary_segment(table)) {
+      return _radix_sort<uint32_t>(table, [&](const BaseSegment& segment, const auto& emit) {
+        _resolve_value_ids(segment, *dictionary_segment, emit);
+      });
+    }
+
+    if constexpr (std::is_arithmetic_v<T>) {
+      using Key = decltype(radix_key(std::declval<T>()));
+      return _radix_sort<Key>(table, [](const BaseSegment& segment, const auto& emit) {
+        resolve_segment_values<T>(segment,
+                                  [&](const size_t position, const T& value) { emit(position, radix_key(value)); });
+      });
+    } else {
+      return _comparison_sort(table);
+    }
+  }
+
+ protected:
+  // Returns the DictionarySegment that all values of the sort column come from - either directly or through
+  // ReferenceSegments that reference a single chunk - or nullptr if there is none
+  const DictionarySegment<T>* _single_dictionary_segment(const Table& table) const {
+    const DictionarySegment<T>* dictionary_segment = nullptr;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.size() == 0) continue;
+
+      const auto* segment = chunk.get_segment(_sort._column_id).get();
+      if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(segment)) {
+        auto referenced_chunk_id = ChunkID{0};
+        if (const auto chunk_pos_list = reference_segment->chunk_pos_list()) {
+          referenced_chunk_id = chunk_pos_list->chunk_id();
+        } else if (reference_segment->pos_list()->references_single_chunk()) {
+          referenced_chunk_id = reference_segment->pos_list()->front().chunk_id;
+        } else {
+          return nullptr;
+        }
+
+        const auto& referenced_chunk = reference_segment->referenced_table()->get_chunk(referenced_chunk_id);
+        segment = referenced_chunk.get_segment(reference_segment->referenced_column_id()).get();
+      }
+
+      const auto chunk_dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(segment);
+      if (!chunk_dictionary_segment) return nullptr;
+      if (dictionary_segment && chunk_dictionary_segment != dictionary_segment) return nullptr;
+      dictionary_segment = chunk_dictionary_segment;
+    }
+
+    return dictionary_segment;
+  }
+
+  // calls emit(position, value_id) for every row of segment, which is either dictionary_segment or references it
+  template <typename Emit>
+  static void _resolve_value_ids(const BaseSegment& segment, const DictionarySegment<T>& dictionary_segment,
+                                 const Emit& emit) {
+    resolve_attribute_vector_width(*dictionary_segment.attribute_vector(), [&](const auto& value_ids) {
+      if (&segment == &dictionary_segment) {
+        for (auto position = size_t{0}; position < value_ids.size(); ++position) {
+          emit(position, static_cast<uint32_t>(value_ids[position]));
+        }
+        return;
+      }
+
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(segment);
+      if (const auto chunk_pos_list = reference_segment.chunk_pos_list()) {
+        chunk_pos_list->for_each([&](const size_t position, const ChunkOffset chunk_offset) {
+          emit(position, static_cast<uint32_t>(value_ids[chunk_offset]));
+        });
+        return;
+      }
+
+      const auto& pos_list = *reference_segment.pos_list();
+      for (auto position = size_t{0}; position < pos_list.size(); ++position) {
+        emit(position, static_cast<uint32_t>(value_ids[pos_list[position].chunk_offset]));
+      }
+    });
+  }
+
+  // Materializes the keys of all rows in parallel per chunk and radix sorts them. resolve_keys(segment, emit) calls
+  // emit(position, key) for every row of a segment.
+  template <typename Key, typename ResolveKeys>
+  std::shared_ptr<PosList> _radix_sort(const Table& table, const ResolveKeys& resolve_keys) const {
+    const auto chunk_begins = _chunk_begins(table);
+    auto elements = std::vector<RadixElement<Key>>(chunk_begins.back());
+
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      tasks.emplace_back([&, chunk_id]() {
+        auto* chunk_elements = elements.data() + chunk_begins[chunk_id];
+        const auto& segment = *table.get_chunk(chunk_id).get_segment(_sort._column_id);
+        resolve_keys(segment, [&](const size_t position, const Key key) {
+          // in descending order, the keys are inverted
+          chunk_elements[position] =
+              RadixElement<Key>{_descending ? static_cast<Key>(~key) : key, RowID{chunk_id, ChunkOffset(position)}};
+        });
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    radix_sort(elements);
+
+    auto positions = std::make_shared<PosList>(elements.size());
+    std::transform(elements.cbegin(), elements.cend(), positions->begin(),
+                   [](const RadixElement<Key>& element) { return element.row_id; });
+    return positions;
+  }
+
+  // Sorts every chunk in parallel and merges the sorted chunks pairwise in parallel. Dictionary segments are sorted
+  // with a counting sort over their value ids, all others with a stable comparison sort.
+  std::shared_ptr<PosList> _comparison_sort(const Table& table) const {
+    struct Element {
+      const T* value;
+      RowID row_id;
+    };
+    const auto less = [descending = _descending](const Element& lhs, const Element& rhs) {
+      return descending ? *rhs.value < *lhs.value : *lhs.value < *rhs.value;
+    };
+
+    auto run_begins = _chunk_begins(table);
+    auto elements = std::vector<Element>(run_begins.back());
+
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      tasks.emplace_back([&, chunk_id]() {
+        const auto run_begin = elements.begin() + run_begins[chunk_id];
+        const auto run_end = elements.begin() + run_begins[chunk_id + 1];
+        const auto& segment = *table.get_chunk(chunk_id).get_segment(_sort._column_id);
+
+        if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+          const auto& dictionary = *dictionary_segment->dictionary();
+          const auto bucket = [&](const uint32_t value_id) {
+            return _descending ? dictionary.size() - 1 - value_id : value_id;
+          };
+
+          resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+            auto write_offsets = std::vector<size_t>(dictionary.size() + 1, 0);
+            for (const auto value_id : value_ids) ++write_offsets[bucket(value_id) + 1];
+            std::partial_sum(write_offsets.cbegin(), write_offsets.cend(), write_offsets.begin());
+
+            for (auto position = size_t{0}; position < value_ids.size(); ++position) {
+              const auto value_id = value_ids[position];
+              run_begin[write_offsets[bucket(value_id)]++] =
+                  Element{&dictionary[value_id], RowID{chunk_id, ChunkOffset(position)}};
+            }
+          });
+          return;
+        }
+
+        // the values are not copied, the elements point to them
+        resolve_segment_values<T>(segment, [&](const size_t position, const T& value) {
+          run_begin[position] = Element{&value, RowID{chunk_id, ChunkOffset(position)}};
+        });
+        std::stable_sort(run_begin, run_end, less);
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    // merge neighboring runs in parallel until a single run is left, std::inplace_merge is stable
+    while (run_begins.size() > 2) {
+      const auto run_count = run_begins.size() - 1;
+      tasks.clear();
+      for (auto run_id = size_t{0}; run_id + 1 < run_count; run_id += 2) {
+        tasks.emplace_back([&, run_id]() {
+          const auto first_begin = elements.begin() + run_begins[run_id];
+          const auto second_begin = elements.begin() + run_begins[run_id + 1];
+          const auto second_end = elements.begin() + run_begins[run_id + 2];
+          if (first_begin == second_begin || second_begin == second_end) return;
+
+          // runs that are already in order do not need to be merged
+          if (!less(*second_begin, *(second_begin - 1))) return;
+          std::inplace_merge(first_begin, second_begin, second_end, less);
+        });
+      }
+      WorkerPool::get().execute_and_wait(tasks);
+
+      auto merged_run_begins = std::vector<size_t>{};
+      for (auto run_id = size_t{0}; run_id < run_count; run_id += 2) {
+        merged_run_begins.emplace_back(run_begins[run_id]);
+      }
+      merged_run_begins.emplace_back(run_begins.back());
+      run_begins = std::move(merged_run_begins);
+    }
+
+    auto positions = std::make_shared<PosList>(elements.size());
+    std::transform(elements.cbegin(), elements.cend(), positions->begin(),
+                   [](const Element& element) { return element.row_id; });
+    return positions;
+  }
+
+  // returns the index of the first row of every chunk, followed by the number of rows
+  static std::vector<size_t> _chunk_begins(const Table& table) {
+    auto chunk_begins = std::vector<size_t>{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      chunk_begins.emplace_back(chunk_begins.back() + table.get_chunk(chunk_id).size());
+    }
+    return chunk_begins;
+  }
+
+  Sort& _sort;
+  const bool _descending;
+};
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode)
+    : AbstractOperator(in), _column_id(column_id), _order_by_mode(order_by_mode) {}
+
+ColumnID Sort::column_id() const { return _column_id; }
+
+OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+
+const std::string Sort::name() const { return "Sort"; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto& column_type = input_table->column_type(_column_id);
+  const auto positions = make_unique_by_data_type<BaseSortImpl, SortImpl>(column_type, *this)->sorted_positions();
+
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  // split the sorted positions into chunks of the input table's chunk size, at least one (possibly empty) chunk
+  const auto chunk_size = static_cast<size_t>(input_table->chunk_size());
+  const auto chunk_count = std::max(size_t{1}, (positions->size() + chunk_size - 1) / chunk_size);
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  const auto writer = ReferenceSegmentWriter(input_table);
+
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    tasks.emplace_back([&, chunk_index]() {
+      const auto chunk_begin = positions->cbegin() + chunk_index * chunk_size;
+      const auto chunk_end = positions->cbegin() + std::min(positions->size(), (chunk_index + 1) * chunk_size);
+      const auto chunk_positions = std::make_shared<const PosList>(chunk_begin, chunk_end);
+
+      output_chunks[chunk_index] = std::make_shared<Chunk>();
+      writer.write(*output_chunks[chunk_index], chunk_positions);
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  for (const auto& chunk : output_chunks) {
+    // the first call replaces the existing chunk since it is empty
+    output_table->emplace_chunk(chunk);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class OrderByMode { Ascending, Descending };
+
+// Operator that sorts its input by one column. The values of the column are materialized together with their
+// positions, and the pairs are sorted:
+//  - ints, longs, floats, and doubles are mapped to unsigned integers that have the same order and sorted with a
+//    parallel LSD radix sort. Digits that all values share are skipped.
+//  - strings are sorted with a comparison sort. Every chunk is sorted in parallel (dictionary segments by value id
+//    with a counting sort) and the sorted chunks are merged pairwise in parallel.
+//  - if all values come from a single DictionarySegment, their value ids have the same order as the values, so the
+//    value ids are radix sorted instead - independent of the type.
+//
+// The sort is stable, i.e., rows with equal values keep their order. Thus, a table can be sorted by multiple columns
+// by sorting it by the least significant column first. The output consists of ReferenceSegments, split into chunks
+// of the input table's chunk size.
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+       const OrderByMode order_by_mode = OrderByMode::Ascending);
+
+  ColumnID column_id() const;
+  OrderByMode order_by_mode() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  class BaseSortImpl {
+   public:
+    virtual ~BaseSortImpl() = default;
+
+    // returns the positions of the input table in sorted order
+    virtual std::shared_ptr<PosList> sorted_positions() = 0;
+  };
+
+  template <typename T>
+  class SortImpl;
+
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+};
+
+}  // namespace opossum
@@ -1,10 +1,19 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/pipeline.hpp"
 #include "storage/base_attribute_vector.hpp"
 #include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "utils/tracer.hpp"
+#include "utils/with_comparator.hpp"
 
 namespace opossum {
 
@@ -39,22 +48,68 @@ ScanType TableScan::scan_type() const { return _scan_type; }
 
 const AllTypeVariant& TableScan::search_value() const { return _search_value; }
 
+void TableScan::set_runtime_filter(const std::shared_ptr<const AbstractOperator>& build_input,
+                                   const ColumnID build_column_id, const ColumnID column_id) {
+  Assert(!_output, "Runtime filters need to be set before the scan is executed");
+  _input_right = build_input;
+  _runtime_filter_build_column_id = build_column_id;
+  _runtime_filter_column_id = column_id;
+}
+
+bool TableScan::is_pipelineable() const { return true; }
+
+std::shared_ptr<Table> TableScan::initialize_output_table(const std::shared_ptr<const Table>& input_table) {
+  if (_input_right) {
+    _runtime_filter = std::make_shared<RuntimeFilter>(*_input_table_right(), _runtime_filter_build_column_id);
+    Assert(_runtime_filter->data_type() == input_table->column_type(_runtime_filter_column_id),
+           "Runtime filter and column have differing data types");
+  }
+
+  auto& column_type = input_table->column_type(_column_id);
+  _impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(column_type, *this);
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  return output_table;
+}
+
+std::shared_ptr<Chunk> TableScan::process_morsel(const std::shared_ptr<const Table>& input_table,
+                                                 const ChunkID chunk_id) const {
+  const auto trace_scope = Tracer::Scope{"scan", "scan_chunk", "chunk_id", chunk_id};
+  const auto& chunk = input_table->get_chunk(chunk_id);
+  auto offsets = _impl->scan_chunk(chunk);
+
+  if (_runtime_filter) _runtime_filter->filter(*chunk.get_segment(_runtime_filter_column_id), offsets);
+
+  // The columns of a reference input may point to different tables and columns, e.g., if the input is the output of a
+  // Projection. Without matches, the chunk still gets (empty) segments.
+  auto output_chunk = std::make_shared<Chunk>();
+  ReferenceSegmentWriter::write_subset(*output_chunk, input_table, chunk_id, std::move(offsets));
+  return output_chunk;
+}
+
+const std::string TableScan::name() const { return "TableScan"; }
+
 std::shared_ptr<const Table> TableScan::_on_execute() {
-  auto& column_type = _input_table_left()->column_type(_column_id);
-  const auto implementation = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(column_type);
-  return implementation->on_execute(*this);
+  return Pipeline::execute_operators({this}, _input_table_left());
 }
 
+template <typename T>
+TableScan::TableScanImpl<T>::TableScanImpl(const TableScan& scan_operator)
+    : _scan_operator(scan_operator), _search_value(type_cast<T>(scan_operator.search_value())) {}
+
 template <typename T>
 void TableScan::TableScanImpl<T>::_compare_value_segment(std::shared_ptr<ValueSegment<T>> segment,
                                                          const ScanType& scan_type, const T& search_value,
-                                                         std::shared_ptr<PosList> pos_list, ChunkID chunk_id) {
+                                                         std::vector<ChunkOffset>& offsets) const {
   // retrieve data vector directly since it contains the actual data type (so we don't have to use AllTypeVariant)
   const auto& data = segment->values();
   for (ChunkOffset row_index{0}; row_index < data.size(); row_index++) {
     auto value = data[row_index];
     if (compare(scan_type, value, search_value)) {
-      pos_list->emplace_back(RowID{chunk_id, row_index});
+      offsets.emplace_back(row_index);
     }
   }
 }
@@ -62,7 +117,7 @@ void TableScan::TableScanImpl<T>::_compare_value_segment(std::shared_ptr<ValueSe
 template <typename T>
 void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<DictionarySegment<T>> segment,
                                                               const ScanType& scan_type, const T& search_value,
-                                                              std::shared_ptr<PosList> pos_list, ChunkID chunk_id) {
+                                                              std::vector<ChunkOffset>& offsets) const {
   auto attribute_vector = segment->attribute_vector();
   auto lower_bound = segment->lower_bound(search_value);
   auto upper_bound = segment->upper_bound(search_value);
@@ -79,7 +134,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
         auto value_id = attribute_vector->get(row_index);
         if (value_id == lower_bound) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
       }
       break;
@@ -89,7 +144,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       // if the value of the lower bound does not equal the search value, no value equals it
       if (lower_bound == INVALID_VALUE_ID || segment->value_by_value_id(lower_bound) != search_value) {
         for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
         break;
       }
@@ -98,7 +153,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
         auto value_id = attribute_vector->get(row_index);
         if (value_id != lower_bound) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
       }
       break;
@@ -107,7 +162,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       // if the lower bound equals INVALID_VALUE_ID all values are smaller than the search value
       if (lower_bound == INVALID_VALUE_ID) {
         for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
         break;
       }
@@ -116,7 +171,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
         auto value_id = attribute_vector->get(row_index);
         if (value_id < lower_bound) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
       }
       break;
@@ -126,7 +181,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       // if the upper bound equals INVALID_VALUE_ID all values are smaller than or equal to the search value
       if (lower_bound == INVALID_VALUE_ID || upper_bound == INVALID_VALUE_ID) {
         for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
         break;
       }
@@ -137,7 +192,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
         for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
           auto value_id = attribute_vector->get(row_index);
           if (value_id <= lower_bound) {
-            pos_list->emplace_back(RowID{chunk_id, row_index});
+            offsets.emplace_back(row_index);
           }
         }
       } else {
@@ -145,7 +200,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
         for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
           auto value_id = attribute_vector->get(row_index);
           if (value_id < lower_bound) {
-            pos_list->emplace_back(RowID{chunk_id, row_index});
+            offsets.emplace_back(row_index);
           }
         }
       }
@@ -161,7 +216,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
         auto value_id = attribute_vector->get(row_index);
         if (value_id >= upper_bound) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
       }
       break;
@@ -176,7 +231,7 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
       for (ChunkOffset row_index{0}; row_index < attribute_vector->size(); row_index++) {
         auto value_id = attribute_vector->get(row_index);
         if (value_id >= lower_bound) {
-          pos_list->emplace_back(RowID{chunk_id, row_index});
+          offsets.emplace_back(row_index);
         }
       }
       break;
@@ -188,93 +243,43 @@ void TableScan::TableScanImpl<T>::_compare_dictionary_segment(std::shared_ptr<Di
 template <typename T>
 void TableScan::TableScanImpl<T>::_compare_reference_segment(std::shared_ptr<ReferenceSegment> segment,
                                                              const ScanType& scan_type, const T& search_value,
-                                                             std::shared_ptr<PosList> pos_list, ChunkID chunk_id,
-                                                             ColumnID column_id) {
-  for (const auto& row_id : *(segment->pos_list())) {
-    const auto& referenced_chunk = segment->referenced_table()->get_chunk(row_id.chunk_id);
-    const auto& referenced_segment = referenced_chunk.get_segment(column_id);
-
-    // the references segment needs to be either a value segment or a dictionary segment
-    auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(referenced_segment);
-    auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(referenced_segment);
-
-    DebugAssert(value_segment != nullptr || dictionary_segment != nullptr,
-                "Reference segment does not point to value "
-                "or dictionary segment");
-    // retrieve the value from the referenced segment
-    T value;
-    if (value_segment != nullptr) {
-      value = value_segment->values()[row_id.chunk_offset];
-    } else {
-      value = dictionary_segment->get(row_id.chunk_offset);
-    }
-
-    if (compare(scan_type, value, search_value)) {
-      // use the original row id instead of referencing the reference segment
-      pos_list->emplace_back(row_id);
-    }
+                                                             std::vector<ChunkOffset>& offsets) const {
+  // resolve the referenced values chunk by chunk instead of looking up the referenced segment for every position
+  auto matches = std::vector<bool>(segment->size());
+  with_comparator(scan_type, [&](auto comparator) {
+    resolve_reference_segment<T>(*segment, [&](const size_t position, const T& value) {
+      matches[position] = comparator(value, search_value);
+    });
+  });
+
+  for (ChunkOffset row_index{0}; row_index < matches.size(); row_index++) {
+    if (matches[row_index]) offsets.emplace_back(row_index);
   }
 }
 
 template <typename T>
-std::shared_ptr<const Table> TableScan::TableScanImpl<T>::on_execute(TableScan& scan_operator) {
-  const auto& input_table = scan_operator._input_table_left();
-
-  // these are used if the input is a reference segment
-  // in that case we need to correctly reference the input table of that reference segment instead of the input table
-  // to this scan
-  std::shared_ptr<const Table> referenced_table;
-  bool reference_reference_segment = false;
-
-  const auto search_value = type_cast<T>(scan_operator.search_value());
-  auto result_row_ids = std::make_shared<PosList>();
-
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
-    // retrieve the segment of the searched column from the input table
-    const auto& current_chunk = input_table->get_chunk(chunk_id);
-    const auto& segment = current_chunk.get_segment(scan_operator.column_id());
-
-    // try to cast to every kind of segment to find out which segment it is
-    auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
-    auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment);
-    auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
-
-    // call the correct compare method for the type of segment we have
-    if (value_segment != nullptr) {
-      _compare_value_segment(value_segment, scan_operator.scan_type(), search_value, result_row_ids, chunk_id);
-    } else if (dictionary_segment != nullptr) {
-      _compare_dictionary_segment(dictionary_segment, scan_operator.scan_type(), search_value, result_row_ids,
-                                  chunk_id);
-    } else if (reference_segment != nullptr) {
-      _compare_reference_segment(reference_segment, scan_operator.scan_type(), search_value, result_row_ids, chunk_id,
-                                 scan_operator.column_id());
-
-      // remember the input table of the reference segment
-      reference_reference_segment = true;
-      referenced_table = reference_segment->referenced_table();
-    } else {
-      Fail("Column and search value have differing data types");
-    }
+std::vector<ChunkOffset> TableScan::TableScanImpl<T>::scan_chunk(const Chunk& chunk) const {
+  // retrieve the segment of the searched column
+  const auto& segment = chunk.get_segment(_scan_operator.column_id());
+  auto offsets = std::vector<ChunkOffset>{};
+
+  // try to cast to every kind of segment to find out which segment it is
+  auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
+  auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment);
+  auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
+
+  // call the correct compare method for the type of segment we have
+  if (value_segment != nullptr) {
+    _compare_value_segment(value_segment, _scan_operator.scan_type(), _search_value, offsets);
+  } else if (dictionary_segment != nullptr) {
+    _compare_dictionary_segment(dictionary_segment, _scan_operator.scan_type(), _search_value, offsets);
+  } else if (reference_segment != nullptr) {
+    _compare_reference_segment(reference_segment, _scan_operator.scan_type(), _search_value, offsets);
+  } else {
+    Fail("Column and search value have differing data types");
   }
 
-  // create the result table
-  auto result_table = std::make_shared<Table>();
-  for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
-    result_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
-  }
-
-  // create a reference segment with the same pos_list for each column and add them to a chunk
-  auto chunk = std::make_shared<Chunk>();
-  auto segment_table = reference_reference_segment ? referenced_table : input_table;
-  for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
-    auto reference_segment = std::make_shared<ReferenceSegment>(segment_table, column_id, result_row_ids);
-    chunk->add_segment(reference_segment);
-  }
-
-  // this replaces the existing chunk since it is empty
-  result_table->emplace_chunk(chunk);
-
-  return result_table;
+  return offsets;
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(TableScan::TableScanImpl);
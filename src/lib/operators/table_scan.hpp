@@ -7,6 +7,8 @@
 
 #include "abstract_operator.hpp"
 #include "all_type_variant.hpp"
+#include "runtime_filter.hpp"
+#include "storage/chunk_pos_list.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
@@ -28,32 +30,62 @@ class TableScan : public AbstractOperator {
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  // Additionally drops the rows whose value in column_id does not occur in the column build_column_id of the output of
+  // build_input, e.g., the build side of a join that consumes the output of the scan. The check uses a RuntimeFilter,
+  // so some of these rows may remain. build_input becomes the right input of the scan. Call this before execute().
+  void set_runtime_filter(const std::shared_ptr<const AbstractOperator>& build_input, const ColumnID build_column_id,
+                          const ColumnID column_id);
+
+  // Every input chunk with matches becomes an output chunk that references them. Thus, the output mirrors the chunking
+  // of the input and no output chunk can exceed the ChunkOffset range.
+  bool is_pipelineable() const override;
+  std::shared_ptr<Table> initialize_output_table(const std::shared_ptr<const Table>& input_table) override;
+  std::shared_ptr<Chunk> process_morsel(const std::shared_ptr<const Table>& input_table,
+                                        const ChunkID chunk_id) const override;
+
+  const std::string name() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   const ColumnID _column_id;
   const ScanType _scan_type;
   const AllTypeVariant _search_value;
 
+  ColumnID _runtime_filter_build_column_id{0};
+  ColumnID _runtime_filter_column_id{0};
+
+  // built from the right input when the scan is executed
+  std::shared_ptr<const RuntimeFilter> _runtime_filter;
+
   class BaseTableScanImpl {
    public:
     virtual ~BaseTableScanImpl() = default;
-    virtual std::shared_ptr<const Table> on_execute(TableScan& scan_operator) = 0;
+
+    // returns the offsets of the rows of the chunk that match the scan
+    virtual std::vector<ChunkOffset> scan_chunk(const Chunk& chunk) const = 0;
   };
 
   template <typename T>
   class TableScanImpl : public BaseTableScanImpl {
    public:
-    std::shared_ptr<const Table> on_execute(TableScan& scan_operator) override;
+    explicit TableScanImpl(const TableScan& scan_operator);
+
+    std::vector<ChunkOffset> scan_chunk(const Chunk& chunk) const override;
 
    protected:
     void _compare_value_segment(std::shared_ptr<ValueSegment<T>> segment, const ScanType& scan_type,
-                                const T& search_value, std::shared_ptr<PosList> pos_list, ChunkID chunk_id);
+                                const T& search_value, std::vector<ChunkOffset>& offsets) const;
     void _compare_dictionary_segment(std::shared_ptr<DictionarySegment<T>> segment, const ScanType& scan_type,
-                                     const T& search_value, std::shared_ptr<PosList> pos_list, ChunkID chunk_id);
+                                     const T& search_value, std::vector<ChunkOffset>& offsets) const;
     void _compare_reference_segment(std::shared_ptr<ReferenceSegment> segment, const ScanType& scan_type,
-                                    const T& search_value, std::shared_ptr<PosList> pos_list, ChunkID chunk_id,
-                                    ColumnID column_id);
+                                    const T& search_value, std::vector<ChunkOffset>& offsets) const;
+
+    const TableScan& _scan_operator;
+    const T _search_value;
   };
+
+  // created for the data type of the scanned column when the output table is initialized
+  std::unique_ptr<BaseTableScanImpl> _impl;
 };
 
 }  // namespace opossum
@@ -0,0 +1,149 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/reference_segment_writer.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+class TopK::TopKImpl : public BaseTopKImpl {
+ public:
+  explicit TopKImpl(TopK& top_k) : _top_k(top_k), _descending(top_k._order_by_mode == OrderByMode::Descending) {}
+
+  std::shared_ptr<PosList> top_k_positions() override {
+    const auto& table = *_top_k._input_table_left();
+    const auto chunk_count = static_cast<size_t>(table.chunk_count());
+    const auto k = _top_k._k;
+    if (k == 0 || chunk_count == 0) return std::make_shared<PosList>();
+
+    const auto task_count = std::max(size_t{1}, std::min(chunk_count, WorkerPool::get().worker_count()));
+    auto heaps = std::vector<std::vector<Element>>(task_count);
+
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back([&, task_id]() {
+        // the heap is ordered so that its front is the worst of the best rows
+        auto& heap = heaps[task_id];
+        const auto heap_order = [&](const Element& lhs, const Element& rhs) {
+          return _is_better(lhs.value, lhs.row_id, rhs);
+        };
+
+        const auto first_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * task_id / task_count)};
+        const auto end_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * (task_id + 1) / task_count)};
+        for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+          const auto& segment = *table.get_chunk(chunk_id).get_segment(_top_k._column_id);
+
+          // The rows of this chunk come after all rows in the heap, so they lose ties. Thus, if even the best value
+          // of the chunk is not better than the worst value in the heap, no row of the chunk can make it.
+          const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+          if (heap.size() == k && dictionary_segment && !dictionary_segment->dictionary()->empty()) {
+            const auto& dictionary = *dictionary_segment->dictionary();
+            const auto& best_value = _descending ? dictionary.back() : dictionary.front();
+            if (!_is_better_value(best_value, heap.front().value)) continue;
+          }
+
+          resolve_segment_values<T>(segment, [&](const size_t position, const T& value) {
+            const auto row_id = RowID{chunk_id, static_cast<ChunkOffset>(position)};
+            if (heap.size() < k) {
+              heap.emplace_back(Element{value, row_id});
+              std::push_heap(heap.begin(), heap.end(), heap_order);
+              return;
+            }
+
+            if (!_is_better(value, row_id, heap.front())) return;
+            std::pop_heap(heap.begin(), heap.end(), heap_order);
+            heap.back() = Element{value, row_id};
+            std::push_heap(heap.begin(), heap.end(), heap_order);
+          });
+        }
+      });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    // merge the heaps of all tasks
+    auto elements = std::move(heaps.front());
+    for (auto task_id = size_t{1}; task_id < task_count; ++task_id) {
+      elements.insert(elements.end(), heaps[task_id].cbegin(), heaps[task_id].cend());
+    }
+    std::sort(elements.begin(), elements.end(),
+              [&](const Element& lhs, const Element& rhs) { return _is_better(lhs.value, lhs.row_id, rhs); });
+    elements.resize(std::min(elements.size(), k));
+
+    auto positions = std::make_shared<PosList>(elements.size());
+    std::transform(elements.cbegin(), elements.cend(), positions->begin(),
+                   [](const Element& element) { return element.row_id; });
+    return positions;
+  }
+
+ protected:
+  // a value of the column and its position in the input table
+  struct Element {
+    T value;
+    RowID row_id;
+  };
+
+  bool _is_better_value(const T& lhs, const T& rhs) const { return _descending ? rhs < lhs : lhs < rhs; }
+
+  // returns whether the row at row_id with the given value comes before element, ties are broken by position
+  bool _is_better(const T& value, const RowID& row_id, const Element& element) const {
+    if (_is_better_value(value, element.value)) return true;
+    if (_is_better_value(element.value, value)) return false;
+    return row_id < element.row_id;
+  }
+
+  TopK& _top_k;
+  const bool _descending;
+};
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const size_t k,
+           const OrderByMode order_by_mode)
+    : AbstractOperator(in), _column_id(column_id), _k(k), _order_by_mode(order_by_mode) {}
+
+ColumnID TopK::column_id() const { return _column_id; }
+
+size_t TopK::k() const { return _k; }
+
+OrderByMode TopK::order_by_mode() const { return _order_by_mode; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto& column_type = input_table->column_type(_column_id);
+  const auto positions = make_unique_by_data_type<BaseTopKImpl, TopKImpl>(column_type, *this)->top_k_positions();
+
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  // split the positions into chunks of the input table's chunk size, at least one (possibly empty) chunk
+  const auto writer = ReferenceSegmentWriter(input_table);
+  const auto chunk_size = static_cast<size_t>(input_table->chunk_size());
+  auto chunk_begin = size_t{0};
+  do {
+    const auto chunk_end = std::min(positions->size(), chunk_begin + chunk_size);
+    const auto chunk_positions =
+        std::make_shared<const PosList>(positions->cbegin() + chunk_begin, positions->cbegin() + chunk_end);
+    auto chunk = std::make_shared<Chunk>();
+    writer.write(*chunk, chunk_positions);
+    output_table->emplace_chunk(chunk);
+    chunk_begin = chunk_end;
+  } while (chunk_begin < positions->size());
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that returns the k first rows of its input in the order of the given column, i.e., the same rows as a
+// Sort followed by a Limit, but without sorting the entire input:
+//  - ranges of chunks are processed in parallel. Every task keeps the best k rows it has seen so far in a bounded
+//    heap, so each row costs a comparison with the worst of them.
+//  - the dictionary of a DictionarySegment holds the minimum and maximum of its chunk. Once a heap is full, chunks
+//    whose best value cannot beat its worst row are skipped without looking at their rows.
+//  - finally, the heaps are merged and sorted.
+// Rows with equal values are ordered by their position in the input. The output consists of ReferenceSegments.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const size_t k,
+       const OrderByMode order_by_mode = OrderByMode::Ascending);
+
+  ColumnID column_id() const;
+  size_t k() const;
+  OrderByMode order_by_mode() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  class BaseTopKImpl {
+   public:
+    virtual ~BaseTopKImpl() = default;
+
+    // returns the positions of the top k rows of the input table in order
+    virtual std::shared_ptr<PosList> top_k_positions() = 0;
+  };
+
+  template <typename T>
+  class TopKImpl;
+
+  const ColumnID _column_id;
+  const size_t _k;
+  const OrderByMode _order_by_mode;
+};
+
+}  // namespace opossum
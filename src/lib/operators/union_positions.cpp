@@ -0,0 +1,17 @@
+#include "union_positions.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+const std::string UnionPositions::name() const { return "UnionPositions"; }
+
+std::shared_ptr<const ChunkPosList> UnionPositions::_combine(const std::shared_ptr<const ChunkPosList>& left,
+                                                             const std::shared_ptr<const ChunkPosList>& right) const {
+  if (!left) return right;
+  if (!right) return left;
+  return ChunkPosList::unite(*left, *right);
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include "cpu_time_account.hpp"
+
+#include <time.h>  // NOLINT
+
+#include <chrono>
+#include <optional>
+
+namespace opossum {
+
+namespace {
+
+thread_local CpuTimeAccount* current_account = nullptr;
+
+// CPU time of the calling thread when it switched to its current account
+thread_local uint64_t current_account_start = 0;
+
+// hardware counters of the calling thread when it switched to its current account, if they were enabled
+thread_local std::optional<HardwareCounterReadings> current_account_readings;
+
+uint64_t thread_cpu_nanoseconds() {
+  auto time = timespec{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return static_cast<uint64_t>(time.tv_sec) * 1'000'000'000 + static_cast<uint64_t>(time.tv_nsec);
+}
+
+}  // namespace
+
+CpuTimeAccount* CpuTimeAccount::charge(CpuTimeAccount* account) {
+  const auto previous_account = current_account;
+  if (account == previous_account) return previous_account;
+
+  const auto now = thread_cpu_nanoseconds();
+  if (previous_account) previous_account->_nanoseconds += now - current_account_start;
+  current_account = account;
+  current_account_start = now;
+
+  if (!HardwareCounters::is_enabled()) {
+    current_account_readings.reset();
+    return previous_account;
+  }
+
+  const auto readings = HardwareCounters::read_thread_counters();
+  if (previous_account && current_account_readings) {
+    for (auto counter = size_t{0}; counter < readings.counts.size(); ++counter) {
+      // scaled counts of multiplexed counters are estimates, which may decrease slightly
+      const auto count = readings.counts[counter];
+      const auto previous_count = current_account_readings->counts[counter];
+      if (count > previous_count) previous_account->_hardware_counters[counter] += count - previous_count;
+    }
+    previous_account->_missing_hardware_counters |= static_cast<uint8_t>(~readings.available_counters);
+    previous_account->_has_hardware_counters = true;
+  }
+  current_account_readings = readings;
+  return previous_account;
+}
+
+CpuTimeAccount* CpuTimeAccount::current() { return current_account; }
+
+std::chrono::nanoseconds CpuTimeAccount::cpu_time() const { return std::chrono::nanoseconds{_nanoseconds.load()}; }
+
+HardwareCounterValues CpuTimeAccount::hardware_counters() const {
+  if (!_has_hardware_counters) return HardwareCounterValues{};
+
+  auto readings = HardwareCounterReadings{};
+  for (auto counter = size_t{0}; counter < readings.counts.size(); ++counter) {
+    readings.counts[counter] = _hardware_counters[counter];
+  }
+  readings.available_counters = static_cast<uint8_t>(~_missing_hardware_counters);
+  return HardwareCounterValues::from_readings(readings);
+}
+
+CpuTimeAccount::Scope::Scope(CpuTimeAccount* account) : _previous_account(charge(account)) {}
+
+CpuTimeAccount::Scope::~Scope() { charge(_previous_account); }
+
+}  // namespace opossum
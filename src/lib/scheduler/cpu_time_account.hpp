@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include "types.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+// A CpuTimeAccount sums up the CPU time that threads spend on behalf of something, e.g., an operator. Every thread
+// charges at most one account at a time. Tasks of the WorkerPool charge the account of the thread that queued them, so
+// the account of an operator includes the CPU time of its tasks on all workers, but not that of tasks of other
+// operators that its thread executes while waiting.
+//
+// If HardwareCounters are enabled, the hardware counters of the threads are summed up the same way. A counter is
+// missing if it was not available on one of the threads.
+class CpuTimeAccount : private Noncopyable {
+ public:
+  // Makes the calling thread charge the given account (or none if nullptr) from now on. The CPU time since the last
+  // switch is added to the previous account, which is returned.
+  static CpuTimeAccount* charge(CpuTimeAccount* account);
+
+  // returns the account that the calling thread charges
+  static CpuTimeAccount* current();
+
+  // returns the CPU time charged so far, excluding the time that threads currently charging the account did not add yet
+  std::chrono::nanoseconds cpu_time() const;
+
+  // returns the hardware counters charged so far, all of them are missing if the counters were never enabled
+  HardwareCounterValues hardware_counters() const;
+
+  // charges the account for the lifetime of the scope and restores the previous one afterwards
+  class Scope : private Noncopyable {
+   public:
+    explicit Scope(CpuTimeAccount* account);
+    ~Scope();
+
+   protected:
+    CpuTimeAccount* const _previous_account;
+  };
+
+ protected:
+  std::atomic<uint64_t> _nanoseconds{0};
+
+  std::array<std::atomic<uint64_t>, 4> _hardware_counters{};
+  std::atomic<bool> _has_hardware_counters{false};
+  // bitmask of the counters that were not available on a thread that charged the account
+  std::atomic<uint8_t> _missing_hardware_counters{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,128 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "worker_pool.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns an empty table with the columns of the given table and chunk_count chunks without segments. The segments of
+// the morsels are added to these chunks, so that every morsel keeps its chunk id and references into the table are the
+// same for all of them.
+std::shared_ptr<Table> make_intermediate_table(const Table& table, const ChunkID chunk_count) {
+  auto intermediate_table = std::make_shared<Table>(table.chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    intermediate_table->add_column_definition(table.column_name(column_id), table.column_type(column_id));
+  }
+  intermediate_table->create_empty_chunks(chunk_count);
+  return intermediate_table;
+}
+
+}  // namespace
+
+void Pipeline::execute(const std::vector<AbstractOperator*>& operators) {
+  Assert(!operators.empty(), "A pipeline needs at least one operator");
+  for (auto operator_index = size_t{1}; operator_index < operators.size(); ++operator_index) {
+    Assert(operators[operator_index]->input_left().get() == operators[operator_index - 1],
+           "Every operator of a pipeline needs to consume the output of the previous one");
+  }
+
+  const auto input_table = operators.front()->_input_table_left();
+  operators.back()->_execute_and_record([&]() { return execute_operators(operators, input_table); }, {input_table});
+  for (const auto op : operators) {
+    op->_performance_data.pipelined = operators.size() > 1;
+  }
+}
+
+std::shared_ptr<const Table> Pipeline::execute_operators(const std::vector<AbstractOperator*>& operators,
+                                                         const std::shared_ptr<const Table>& input_table) {
+  // Each operator but the last writes its output chunks to an intermediate table, which is the input of the next one.
+  // The chunks of ReferenceSegments are released once the next operator has processed them, since we never reference
+  // references. Data segments may be referenced by the following output, e.g., by a TableScan on top of a Materialize.
+  const auto chunk_count = static_cast<size_t>(input_table->chunk_count());
+  auto input_tables = std::vector<std::shared_ptr<const Table>>{input_table};
+  auto intermediate_tables = std::vector<std::shared_ptr<Table>>{};
+  auto output_table = std::shared_ptr<Table>{};
+  for (const auto op : operators) {
+    Assert(op->is_pipelineable(), "Operator cannot be pipelined");
+    output_table = op->initialize_output_table(input_tables.back());
+    if (op == operators.back()) break;
+
+    intermediate_tables.emplace_back(make_intermediate_table(*output_table, input_table->chunk_count()));
+    input_tables.emplace_back(intermediate_tables.back());
+  }
+
+  // Morsels are not assigned to tasks upfront: every task takes the next unprocessed chunk until none is left, so that
+  // chunks that are cheaper to process, e.g., because most of their rows are filtered out, do not leave workers idle.
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  auto next_chunk_id = std::atomic<size_t>{0};
+
+  // rows and chunks passed on by each operator but the last
+  auto passed_row_counts = std::vector<std::atomic<uint64_t>>(operators.size() - 1);
+  auto passed_chunk_counts = std::vector<std::atomic<uint64_t>>(operators.size() - 1);
+
+  const auto task_count = std::max(size_t{1}, std::min(chunk_count, WorkerPool::get().worker_count()));
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    tasks.emplace_back([&]() {
+      for (auto morsel_id = next_chunk_id++; morsel_id < chunk_count; morsel_id = next_chunk_id++) {
+        const auto chunk_id = ChunkID{static_cast<uint32_t>(morsel_id)};
+        auto chunk = operators.front()->process_morsel(input_table, chunk_id);
+
+        for (auto operator_index = size_t{1}; operator_index < operators.size(); ++operator_index) {
+          if (chunk->size() == 0 && chunk_id != ChunkID{0}) break;
+          passed_row_counts[operator_index - 1] += chunk->size();
+          ++passed_chunk_counts[operator_index - 1];
+
+          auto& intermediate_chunk = intermediate_tables[operator_index - 1]->get_chunk(chunk_id);
+          for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+            intermediate_chunk.add_segment(chunk->get_segment(column_id));
+          }
+          chunk = operators[operator_index]->process_morsel(input_tables[operator_index], chunk_id);
+
+          if (intermediate_chunk.column_count() > 0 &&
+              std::dynamic_pointer_cast<const ReferenceSegment>(intermediate_chunk.get_segment(ColumnID{0}))) {
+            intermediate_chunk = Chunk{};
+          }
+        }
+        output_chunks[chunk_id] = chunk;
+      }
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  for (auto operator_index = size_t{0}; operator_index + 1 < operators.size(); ++operator_index) {
+    auto& performance_data = operators[operator_index]->_performance_data;
+    performance_data.input_row_count =
+        operator_index == 0 ? input_table->row_count() : passed_row_counts[operator_index - 1].load();
+    performance_data.input_chunk_count =
+        operator_index == 0 ? chunk_count : passed_chunk_counts[operator_index - 1].load();
+    performance_data.output_row_count = passed_row_counts[operator_index];
+    performance_data.output_chunk_count = passed_chunk_counts[operator_index];
+    performance_data.executed = true;
+  }
+
+  // the first call replaces the existing chunk since it is empty
+  for (const auto& output_chunk : output_chunks) {
+    if (output_chunk->size() > 0) output_table->emplace_chunk(output_chunk);
+  }
+
+  // without any rows, the output of the first chunk keeps the segments of the result unless the table has some already
+  if (output_table->row_count() == 0 && chunk_count > 0 && output_table->get_chunk(ChunkID{0}).column_count() == 0) {
+    output_table->emplace_chunk(output_chunks.front());
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+// A Pipeline executes a chain of pipelineable operators (see AbstractOperator::is_pipelineable), e.g., a TableScan
+// whose output is filtered by another TableScan and then passed to a Projection, morsel by morsel. Every worker takes
+// the next chunk of the input table and pushes it through all operators before it takes another one, so the chunk
+// stays in its cache and no intermediate table is materialized. Only the output of the last operator is kept.
+//  - the output chunks of an operator are passed on in an intermediate table with the chunk ids of the input table.
+//    Its chunks only hold segments while the morsel is processed, unless they are referenced.
+//  - morsels that become empty are dropped, except for the first chunk, so that an empty result still has segments
+//  - the output chunks are kept in the order of the input chunks
+// Operators that need their entire input, i.e., joins, sorts, and aggregations, break pipelines. They consume the
+// output of the last operator of a pipeline.
+class Pipeline : private Noncopyable {
+ public:
+  // Executes the operators, each of which has the previous one as its left input, and sets the output of the last one.
+  // The others remain without output, but get the rows and chunks they passed on as their performance data.
+  static void execute(const std::vector<AbstractOperator*>& operators);
+
+  // returns the output of the last operator when the operators are applied to the given input table one after another
+  static std::shared_ptr<const Table> execute_operators(const std::vector<AbstractOperator*>& operators,
+                                                       const std::shared_ptr<const Table>& input_table);
+};
+
+}  // namespace opossum
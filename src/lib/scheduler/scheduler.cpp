@@ -0,0 +1,141 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "pipeline.hpp"
+#include "worker_pool.hpp"
+
+namespace opossum {
+
+namespace {
+
+// an operator, or a chain of operators that is executed as a Pipeline, that still needs to be executed
+struct OperatorNode {
+  // ordered from the one that consumes the inputs of the node to the one whose output the consumers read
+  std::vector<AbstractOperator*> operators;
+
+  // number of inputs that have not been executed yet
+  std::atomic<size_t> pending_input_count{0};
+
+  // the nodes of the operators that consume the output of this one
+  std::vector<OperatorNode*> consumers;
+};
+
+using OperatorNodes = std::unordered_map<const AbstractOperator*, std::unique_ptr<OperatorNode>>;
+using ConsumerCounts = std::unordered_map<const AbstractOperator*, size_t>;
+
+// returns the inputs of the operator, each of them once
+std::vector<std::shared_ptr<const AbstractOperator>> inputs(const AbstractOperator& op) {
+  auto inputs = std::vector<std::shared_ptr<const AbstractOperator>>{op.input_left()};
+  // the same operator may be both inputs, e.g., for a self-join
+  if (op.input_right() != op.input_left()) inputs.emplace_back(op.input_right());
+  return inputs;
+}
+
+// counts the consumers of the operators that the given one depends on and that have not been executed yet
+void count_consumers(const AbstractOperator* op, ConsumerCounts& consumer_counts) {
+  if (!op || op->executed()) return;
+
+  for (const auto& input : inputs(*op)) {
+    if (!input || input->executed()) continue;
+    // the inputs of an operator are visited when its first consumer is
+    if (consumer_counts[input.get()]++ == 0) count_consumers(input.get(), consumer_counts);
+  }
+}
+
+// returns whether the operator can be executed in the same pipeline as its left input
+bool is_fusable_with_input(const AbstractOperator& op, const ConsumerCounts& consumer_counts) {
+  const auto input = op.input_left();
+  if (!op.is_pipelineable() || !input || input->executed() || !input->is_pipelineable()) return false;
+  return op.input_right() != input && consumer_counts.at(input.get()) == 1;
+}
+
+// Adds a node for the operator and its inputs unless they have already been executed. Returns nullptr if op has been.
+// Without consumer counts, every operator gets its own node. Otherwise, it is fused with the inputs it can be.
+OperatorNode* add_nodes(const AbstractOperator* op, OperatorNodes& nodes, const ConsumerCounts* consumer_counts) {
+  if (!op || op->executed()) return nullptr;
+
+  const auto node_iter = nodes.find(op);
+  if (node_iter != nodes.end()) return node_iter->second.get();
+
+  // Operators are const for the operators that consume them, which only read their output. The scheduler is the one
+  // that executes them, though.
+  auto& node = nodes[op];
+  node = std::make_unique<OperatorNode>();
+  node->operators.emplace_back(const_cast<AbstractOperator*>(op));
+  while (consumer_counts && is_fusable_with_input(*node->operators.front(), *consumer_counts)) {
+    const auto input = node->operators.front()->input_left();
+    node->operators.insert(node->operators.begin(), const_cast<AbstractOperator*>(input.get()));
+  }
+
+  // the node depends on the inputs of its first operator and on the right inputs of the others
+  auto node_inputs = inputs(*node->operators.front());
+  for (auto operator_index = size_t{1}; operator_index < node->operators.size(); ++operator_index) {
+    const auto right_input = node->operators[operator_index]->input_right();
+    if (std::find(node_inputs.cbegin(), node_inputs.cend(), right_input) == node_inputs.cend()) {
+      node_inputs.emplace_back(right_input);
+    }
+  }
+
+  for (const auto& input : node_inputs) {
+    if (const auto input_node = add_nodes(input.get(), nodes, consumer_counts)) {
+      ++node->pending_input_count;
+      input_node->consumers.emplace_back(node.get());
+    }
+  }
+
+  return node.get();
+}
+
+// executes the operators of the node, and then every consumer whose last input it was
+void execute_node(OperatorNode& node) {
+  if (node.operators.size() == 1) {
+    node.operators.front()->execute();
+  } else {
+    Pipeline::execute(node.operators);
+  }
+
+  auto ready_consumers = std::vector<OperatorNode*>{};
+  for (const auto consumer : node.consumers) {
+    if (--consumer->pending_input_count == 0) ready_consumers.emplace_back(consumer);
+  }
+
+  // a single consumer is executed by this thread, multiple ones are executed concurrently
+  if (ready_consumers.size() == 1) return execute_node(*ready_consumers.front());
+
+  auto tasks = std::vector<std::function<void()>>{};
+  for (const auto consumer : ready_consumers) {
+    tasks.emplace_back([consumer]() { execute_node(*consumer); });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+}
+
+}  // namespace
+
+void Scheduler::execute(const std::shared_ptr<const AbstractOperator>& root, const ExecutionMode mode) {
+  execute(*root, mode);
+}
+
+void Scheduler::execute(const AbstractOperator& root, const ExecutionMode mode) {
+  auto consumer_counts = ConsumerCounts{};
+  if (mode == ExecutionMode::Pipelined) count_consumers(&root, consumer_counts);
+
+  auto nodes = OperatorNodes{};
+  add_nodes(&root, nodes, mode == ExecutionMode::Pipelined ? &consumer_counts : nullptr);
+
+  // start with the operators whose inputs have all been executed, e.g., the leaves of the tree
+  auto tasks = std::vector<std::function<void()>>{};
+  for (const auto& entry : nodes) {
+    const auto node = entry.second.get();
+    if (node->pending_input_count == 0) tasks.emplace_back([node]() { execute_node(*node); });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+}
+
+}  // namespace opossum
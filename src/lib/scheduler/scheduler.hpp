@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// how the Scheduler executes the operators
+enum class ExecutionMode {
+  // every operator is executed on its own and materializes its output
+  OperatorAtATime,
+  // chains of pipelineable operators are fused into Pipelines, which only materialize the output of the last operator
+  Pipelined
+};
+
+// The Scheduler executes a tree (or, more generally, a DAG) of operators, given by its root. The dependencies are
+// derived from input_left() and input_right(): an operator is executed once all of its inputs are, and operators that
+// do not depend on each other, e.g., the two inputs of a join, are executed concurrently. Operators that have already
+// been executed are not executed again, so the same input can be shared by multiple operators.
+//
+// The operators are executed as tasks of the WorkerPool. Operators spawn their own tasks on the same pool, and
+// threads that wait for tasks execute queued ones in the meantime, so inter- and intra-operator parallelism share the
+// workers without blocking each other. The operator that finishes the last input of another operator executes it
+// directly, without going through a queue.
+//
+// In the Pipelined mode, an operator is fused with its left input if both are pipelineable and the input has no other
+// consumer, e.g., a TableScan on top of another TableScan. Each chain of fused operators is executed as a single
+// Pipeline, so only the output of its last operator is materialized. The other operators of the chain remain without
+// output. Joins, sorts, and aggregations are never fused, they execute once their inputs are materialized.
+//
+// If an operator throws, the operators that depend on it are not executed and the exception is rethrown.
+class Scheduler : private Noncopyable {
+ public:
+  // executes the operator and everything it depends on, and returns once the root has been executed
+  static void execute(const std::shared_ptr<const AbstractOperator>& root,
+                      const ExecutionMode mode = ExecutionMode::OperatorAtATime);
+  static void execute(const AbstractOperator& root, const ExecutionMode mode = ExecutionMode::OperatorAtATime);
+};
+
+}  // namespace opossum
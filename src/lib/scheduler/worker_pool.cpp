@@ -0,0 +1,256 @@
+#include "worker_pool.hpp"
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the pool and the queue of the calling thread if it is a worker
+thread_local const WorkerPool* current_pool = nullptr;
+thread_local size_t current_worker_queue_id = 0;
+
+}  // namespace
+
+ScheduledTask::ScheduledTask(std::function<void()> function)
+    : _task(std::move(function)), _future(_task.get_future().share()) {}
+
+const std::shared_future<void>& ScheduledTask::future() const { return _future; }
+
+bool ScheduledTask::_run() {
+  if (_started.exchange(true)) return false;
+
+  // the function is released right away, as it may own the ones waiting for the future (see execute_async)
+  auto task = std::move(_task);
+  const auto cpu_time_scope = CpuTimeAccount::Scope{nullptr};
+  task();
+  return true;
+}
+
+WorkerPool& WorkerPool::get() {
+  static WorkerPool instance;
+  return instance;
+}
+
+WorkerPool::WorkerPool() { _start_workers(std::thread::hardware_concurrency()); }
+
+WorkerPool::~WorkerPool() { _stop_workers(); }
+
+void WorkerPool::set_worker_count(size_t worker_count) {
+  _stop_workers();
+  _start_workers(worker_count);
+}
+
+size_t WorkerPool::worker_count() const {
+  auto lock = std::lock_guard(_mutex);
+  return _workers.size();
+}
+
+void WorkerPool::execute_and_wait(const std::vector<std::function<void()>>& tasks) {
+  if (tasks.empty()) return;
+
+  auto group = std::make_shared<TaskGroup>();
+  group->remaining_tasks = tasks.size();
+
+  auto group_tasks = std::vector<Task>{};
+  group_tasks.reserve(tasks.size());
+  const auto cpu_time_account = CpuTimeAccount::current();
+  for (const auto& function : tasks) {
+    group_tasks.emplace_back(Task{function, group, cpu_time_account});
+  }
+  _queue_tasks(std::move(group_tasks));
+
+  // Help with queued tasks (of any group) until there are none, then wait for the tasks that other threads still
+  // execute. As tasks only wait for the tasks that they queue themselves, a task taken here does not depend on the
+  // ones further down the stack of this thread. Scheduled tasks do not give that guarantee and are never taken here.
+  const auto queue_id = _current_queue_id();
+  while (group->remaining_tasks > 0) {
+    auto task = _take_task(queue_id);
+    if (!task) {
+      auto lock = std::unique_lock(group->mutex);
+      group->finished.wait(lock, [&]() { return group->remaining_tasks == 0; });
+      break;
+    }
+    _run_task(*task);
+  }
+
+  auto lock = std::lock_guard(group->mutex);
+  if (group->exception) std::rethrow_exception(group->exception);
+}
+
+void WorkerPool::schedule(const std::shared_ptr<ScheduledTask>& task) {
+  if (worker_count() == 0) {
+    task->_run();
+    return;
+  }
+
+  // counted like the queued tasks in _queue_tasks
+  {
+    auto lock = std::lock_guard(_sleep_mutex);
+    ++_scheduled_task_count;
+  }
+  {
+    auto lock = std::lock_guard(_scheduled_tasks_mutex);
+    _scheduled_tasks.emplace_back(task);
+  }
+  _task_available.notify_one();
+}
+
+std::shared_ptr<ScheduledTask> WorkerPool::schedule(std::function<void()> function) {
+  auto task = std::make_shared<ScheduledTask>(std::move(function));
+  schedule(task);
+  return task;
+}
+
+void WorkerPool::wait(ScheduledTask& task) {
+  // The task stays in the queue if this thread executes it, the worker that takes it later skips it. Otherwise, a
+  // worker has started it and makes progress without this thread.
+  task._run();
+  task.future().wait();
+}
+
+void WorkerPool::_start_workers(size_t worker_count) {
+  auto lock = std::lock_guard(_mutex);
+  {
+    auto sleep_lock = std::lock_guard(_sleep_mutex);
+    _shutdown = false;
+  }
+
+  _queues.clear();
+  for (auto queue_id = size_t{0}; queue_id <= worker_count; ++queue_id) {
+    _queues.emplace_back(std::make_unique<TaskQueue>());
+  }
+
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back(&WorkerPool::_worker_loop, this, worker_id);
+  }
+}
+
+void WorkerPool::_stop_workers() {
+  {
+    auto lock = std::lock_guard(_sleep_mutex);
+    _shutdown = true;
+  }
+  _task_available.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+
+  auto lock = std::lock_guard(_mutex);
+  _workers.clear();
+}
+
+void WorkerPool::_worker_loop(const size_t queue_id) {
+  current_pool = this;
+  current_worker_queue_id = queue_id;
+  Tracer::set_thread_name("worker " + std::to_string(queue_id));
+
+  while (true) {
+    if (auto task = _take_task(queue_id)) {
+      _run_task(*task);
+      continue;
+    }
+
+    // only idle workers start scheduled tasks
+    if (const auto scheduled_task = _take_scheduled_task()) {
+      scheduled_task->_run();
+      continue;
+    }
+
+    // the queued and scheduled tasks are only finished once the pool shuts down
+    auto lock = std::unique_lock(_sleep_mutex);
+    _task_available.wait(lock, [&]() { return _shutdown || _queued_task_count > 0 || _scheduled_task_count > 0; });
+    if (_queued_task_count == 0 && _scheduled_task_count == 0) return;
+  }
+}
+
+size_t WorkerPool::_current_queue_id() const {
+  if (current_pool == this) return current_worker_queue_id;
+  return _queues.size() - 1;
+}
+
+void WorkerPool::_queue_tasks(std::vector<Task>&& tasks) {
+  // The tasks are counted before they are queued, so that the count never falls below the number of queued tasks.
+  // Counting them under the mutex makes sure that no worker misses them while falling asleep.
+  {
+    auto lock = std::lock_guard(_sleep_mutex);
+    _queued_task_count += tasks.size();
+  }
+
+  {
+    auto& queue = *_queues[_current_queue_id()];
+    auto lock = std::lock_guard(queue.mutex);
+    for (auto& task : tasks) {
+      queue.tasks.emplace_back(std::move(task));
+    }
+  }
+  _task_available.notify_all();
+}
+
+std::optional<WorkerPool::Task> WorkerPool::_take_task(const size_t queue_id) {
+  if (_queued_task_count == 0) return std::nullopt;
+
+  for (auto offset = size_t{0}; offset < _queues.size(); ++offset) {
+    auto& queue = *_queues[(queue_id + offset) % _queues.size()];
+    auto lock = std::lock_guard(queue.mutex);
+    if (queue.tasks.empty()) continue;
+
+    // the own queue is used as a stack, other queues are stolen from at the other end
+    auto task = std::optional<Task>{};
+    if (offset == 0) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    --_queued_task_count;
+    return task;
+  }
+
+  return std::nullopt;
+}
+
+std::shared_ptr<ScheduledTask> WorkerPool::_take_scheduled_task() {
+  if (_scheduled_task_count == 0) return nullptr;
+
+  auto lock = std::lock_guard(_scheduled_tasks_mutex);
+  if (_scheduled_tasks.empty()) return nullptr;
+  auto task = std::move(_scheduled_tasks.front());
+  _scheduled_tasks.pop_front();
+  --_scheduled_task_count;
+  return task;
+}
+
+void WorkerPool::_run_task(Task& task) {
+  auto exception = std::exception_ptr{};
+  {
+    const auto cpu_time_scope = CpuTimeAccount::Scope{task.cpu_time_account};
+    try {
+      task.function();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+  }
+
+  // the counter is decremented while holding the mutex, so that a waiting thread cannot miss the notification
+  auto& group = *task.group;
+  auto lock = std::lock_guard(group.mutex);
+  if (exception && !group.exception) group.exception = exception;
+  if (--group.remaining_tasks == 0) group.finished.notify_all();
+}
+
+}  // namespace opossum
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "cpu_time_account.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A task that is queued with WorkerPool::schedule. It is executed exactly once: by an idle worker or, if no worker has
+// started it yet, by the first thread that waits for it (see WorkerPool::wait).
+class ScheduledTask : private Noncopyable {
+ public:
+  explicit ScheduledTask(std::function<void()> function);
+
+  // becomes ready once the task is finished and rethrows the exception that the task threw
+  const std::shared_future<void>& future() const;
+
+ protected:
+  friend class WorkerPool;
+
+  // executes the task unless another thread has started it, returns whether this thread executed it
+  bool _run();
+
+  std::packaged_task<void()> _task;
+  std::shared_future<void> _future;
+  std::atomic<bool> _started{false};
+};
+
+// The WorkerPool is a singleton that maintains a set of worker threads. Operators use it for intra-operator
+// parallelism, i.e., to process independent parts of their input (e.g., ranges of chunks) concurrently. The Scheduler
+// uses the same pool to execute independent operators concurrently, so both kinds of parallelism share the workers.
+//
+// The number of workers is the degree of parallelism and can be changed with set_worker_count. By default, there is
+// one worker per hardware thread. Without any workers, all tasks are executed by the calling thread.
+//
+// Every worker has its own queue. Tasks are added to the queue of the thread that creates them (threads that are not
+// workers share one queue), and the owner takes the most recently added task, whose data is most likely still in its
+// cache. Threads without tasks in their own queue steal the oldest task of another queue, which is usually the
+// largest piece of remaining work. Thus, threads only contend for a queue when they run out of work.
+//
+// Scheduled tasks (e.g., queries executed in the background) have a separate queue, which only idle workers take
+// tasks from. Threads that wait in execute_and_wait never start them, as a scheduled task may run for long and wait
+// for anything, including tasks that are further down the stack of the waiting thread.
+//
+// The CPU time of a task is charged to the CpuTimeAccount of the thread that queued it (see CpuTimeAccount).
+//
+// Example:
+//   auto tasks = std::vector<std::function<void()>>{};
+//   for (...) tasks.emplace_back([&, chunk_id]() { ... });
+//   WorkerPool::get().execute_and_wait(tasks);
+class WorkerPool : private Noncopyable {
+ public:
+  static WorkerPool& get();
+
+  // Stops the current workers (after they finished all queued tasks) and starts worker_count new ones. This must not
+  // be called while tasks are executed.
+  void set_worker_count(size_t worker_count);
+  size_t worker_count() const;
+
+  // Executes the tasks and blocks until all of them are finished. While waiting, the calling thread executes queued
+  // tasks (but no scheduled ones) itself. Thus, tasks can spawn and wait for further tasks without blocking the pool,
+  // as long as they only wait for the tasks that they queue themselves.
+  // If a task throws, the first exception is rethrown once all tasks are finished.
+  void execute_and_wait(const std::vector<std::function<void()>>& tasks);
+
+  // Queues the task and returns immediately, e.g., to execute a query in the background. Without workers, the task is
+  // executed by the calling thread before schedule returns. Exceptions thrown by the task are passed on through its
+  // future.
+  void schedule(const std::shared_ptr<ScheduledTask>& task);
+  std::shared_ptr<ScheduledTask> schedule(std::function<void()> function);
+
+  // Blocks until the task is finished. If no worker has started it yet, the calling thread executes it itself, so a
+  // worker can wait for a task that it scheduled even if no other worker is idle. Other tasks are not executed in the
+  // meantime. Does not rethrow the exception of the task, see ScheduledTask::future.
+  void wait(ScheduledTask& task);
+
+  ~WorkerPool();
+
+ protected:
+  // A set of tasks that is waited for together
+  struct TaskGroup {
+    std::atomic<size_t> remaining_tasks;
+    std::exception_ptr exception;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+
+  struct Task {
+    std::function<void()> function;
+    std::shared_ptr<TaskGroup> group;
+    // the account that the queueing thread charged
+    CpuTimeAccount* cpu_time_account;
+  };
+
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  WorkerPool();
+
+  void _start_workers(size_t worker_count);
+  void _stop_workers();
+  void _worker_loop(const size_t queue_id);
+
+  // returns the queue of the calling thread: its own for workers, the shared one for all other threads
+  size_t _current_queue_id() const;
+
+  // takes the newest task of the given queue or, if it is empty, steals the oldest task of another queue
+  std::optional<Task> _take_task(const size_t queue_id);
+
+  // takes the oldest scheduled task, only called by idle workers
+  std::shared_ptr<ScheduledTask> _take_scheduled_task();
+
+  // adds the tasks to the queue of the calling thread and wakes up the workers
+  void _queue_tasks(std::vector<Task>&& tasks);
+
+  // executes the task, charging its CpuTimeAccount, and notifies its group
+  void _run_task(Task& task);
+
+  std::vector<std::thread> _workers;
+
+  // one queue per worker, followed by the queue shared by all other threads
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+
+  std::mutex _scheduled_tasks_mutex;
+  std::deque<std::shared_ptr<ScheduledTask>> _scheduled_tasks;
+
+  // number of tasks in all queues and of scheduled tasks, idle workers sleep until one of them becomes positive
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _scheduled_task_count{0};
+  std::mutex _sleep_mutex;
+  std::condition_variable _task_available;
+  bool _shutdown = false;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
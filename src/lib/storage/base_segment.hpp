@@ -28,5 +28,8 @@ class BaseSegment : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns the (approximate) number of bytes used by the segment, including data that it shares with other segments
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
@@ -0,0 +1,174 @@
+#include "chunk_pos_list.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// number of bitmap words per entry of the rank directory
+constexpr auto BITMAP_BLOCK_WORDS = size_t{8};
+
+// a bitmap is used once more than one out of BITMAP_THRESHOLD rows is contained, as it is smaller than 32-bit offsets
+constexpr auto BITMAP_THRESHOLD = size_t{32};
+
+ChunkPosList::ChunkPosList(const ChunkID chunk_id, const ChunkOffset chunk_size, std::vector<ChunkOffset> offsets)
+    : _chunk_id(chunk_id),
+      _chunk_size(chunk_size),
+      _representation(Representation::Offsets),
+      _size(offsets.size()),
+      _offsets(std::move(offsets)) {
+  DebugAssert(std::is_sorted(_offsets.cbegin(), _offsets.cend()), "Offsets need to be sorted");
+  DebugAssert(_offsets.empty() || _offsets.back() < _chunk_size, "Offset exceeds the chunk");
+}
+
+ChunkPosList::ChunkPosList(const ChunkID chunk_id, const ChunkOffset chunk_size, std::vector<uint64_t> bitmap)
+    : _chunk_id(chunk_id),
+      _chunk_size(chunk_size),
+      _representation(Representation::Bitmap),
+      _bitmap(std::move(bitmap)) {
+  Assert(_bitmap.size() == (chunk_size + 63) / 64, "Bitmap size does not match the chunk size");
+
+  _block_ranks.reserve(_bitmap.size() / BITMAP_BLOCK_WORDS + 1);
+  for (auto word_index = size_t{0}; word_index < _bitmap.size(); ++word_index) {
+    if (word_index % BITMAP_BLOCK_WORDS == 0) _block_ranks.emplace_back(static_cast<uint32_t>(_size));
+    _size += __builtin_popcountll(_bitmap[word_index]);
+  }
+}
+
+std::shared_ptr<ChunkPosList> ChunkPosList::make(const ChunkID chunk_id, const ChunkOffset chunk_size,
+                                                 std::vector<ChunkOffset> offsets) {
+  if (offsets.size() * BITMAP_THRESHOLD <= chunk_size) {
+    return std::make_shared<ChunkPosList>(chunk_id, chunk_size, std::move(offsets));
+  }
+
+  auto bitmap = std::vector<uint64_t>((chunk_size + 63) / 64, 0);
+  for (const auto offset : offsets) {
+    bitmap[offset / 64] |= uint64_t{1} << (offset % 64);
+  }
+  return std::make_shared<ChunkPosList>(chunk_id, chunk_size, std::move(bitmap));
+}
+
+std::shared_ptr<ChunkPosList> ChunkPosList::make_from_bitmap(const ChunkID chunk_id, const ChunkOffset chunk_size,
+                                                             std::vector<uint64_t> bitmap) {
+  auto pos_list = std::make_shared<ChunkPosList>(chunk_id, chunk_size, std::move(bitmap));
+  if (pos_list->size() * BITMAP_THRESHOLD > chunk_size) return pos_list;
+
+  // sparse bitmaps are converted to offsets
+  auto offsets = std::vector<ChunkOffset>{};
+  offsets.reserve(pos_list->size());
+  pos_list->for_each([&](const size_t, const ChunkOffset chunk_offset) { offsets.emplace_back(chunk_offset); });
+  return std::make_shared<ChunkPosList>(chunk_id, chunk_size, std::move(offsets));
+}
+
+std::shared_ptr<ChunkPosList> ChunkPosList::make_entire_chunk(const ChunkID chunk_id, const ChunkOffset chunk_size) {
+  auto bitmap = std::vector<uint64_t>((chunk_size + 63) / 64, ~uint64_t{0});
+  if (chunk_size % 64 != 0) bitmap.back() = (uint64_t{1} << (chunk_size % 64)) - 1;
+  return make_from_bitmap(chunk_id, chunk_size, std::move(bitmap));
+}
+
+std::shared_ptr<ChunkPosList> ChunkPosList::intersect(const ChunkPosList& lhs, const ChunkPosList& rhs) {
+  Assert(lhs._chunk_id == rhs._chunk_id && lhs._chunk_size == rhs._chunk_size, "Lists reference different chunks");
+
+  if (lhs._representation == Representation::Offsets && rhs._representation == Representation::Offsets) {
+    auto offsets = std::vector<ChunkOffset>{};
+    std::set_intersection(lhs._offsets.cbegin(), lhs._offsets.cend(), rhs._offsets.cbegin(), rhs._offsets.cend(),
+                          std::back_inserter(offsets));
+    return std::make_shared<ChunkPosList>(lhs._chunk_id, lhs._chunk_size, std::move(offsets));
+  }
+
+  // a sparse list is probed against the bitmap of the other one
+  if (lhs._representation == Representation::Offsets || rhs._representation == Representation::Offsets) {
+    const auto& sparse = lhs._representation == Representation::Offsets ? lhs : rhs;
+    const auto& dense = lhs._representation == Representation::Offsets ? rhs : lhs;
+    auto offsets = std::vector<ChunkOffset>{};
+    for (const auto offset : sparse._offsets) {
+      if (dense._bitmap[offset / 64] & (uint64_t{1} << (offset % 64))) offsets.emplace_back(offset);
+    }
+    return std::make_shared<ChunkPosList>(lhs._chunk_id, lhs._chunk_size, std::move(offsets));
+  }
+
+  auto bitmap = lhs._bitmap;
+  for (auto word_index = size_t{0}; word_index < bitmap.size(); ++word_index) {
+    bitmap[word_index] &= rhs._bitmap[word_index];
+  }
+  return make_from_bitmap(lhs._chunk_id, lhs._chunk_size, std::move(bitmap));
+}
+
+std::shared_ptr<ChunkPosList> ChunkPosList::unite(const ChunkPosList& lhs, const ChunkPosList& rhs) {
+  Assert(lhs._chunk_id == rhs._chunk_id && lhs._chunk_size == rhs._chunk_size, "Lists reference different chunks");
+
+  if (lhs._representation == Representation::Offsets && rhs._representation == Representation::Offsets) {
+    auto offsets = std::vector<ChunkOffset>{};
+    std::set_union(lhs._offsets.cbegin(), lhs._offsets.cend(), rhs._offsets.cbegin(), rhs._offsets.cend(),
+                   std::back_inserter(offsets));
+    return make(lhs._chunk_id, lhs._chunk_size, std::move(offsets));
+  }
+
+  auto bitmap = lhs._as_bitmap();
+  const auto rhs_bitmap = rhs._as_bitmap();
+  for (auto word_index = size_t{0}; word_index < bitmap.size(); ++word_index) {
+    bitmap[word_index] |= rhs_bitmap[word_index];
+  }
+  return std::make_shared<ChunkPosList>(lhs._chunk_id, lhs._chunk_size, std::move(bitmap));
+}
+
+ChunkID ChunkPosList::chunk_id() const { return _chunk_id; }
+
+ChunkOffset ChunkPosList::chunk_size() const { return _chunk_size; }
+
+size_t ChunkPosList::size() const { return _size; }
+
+bool ChunkPosList::empty() const { return _size == 0; }
+
+ChunkPosList::Representation ChunkPosList::representation() const { return _representation; }
+
+ChunkOffset ChunkPosList::operator[](const size_t position) const {
+  DebugAssert(position < _size, "Position out of range");
+  if (_representation == Representation::Offsets) return _offsets[position];
+
+  // find the last block that starts at or before the position, then the word within that block
+  const auto block_iter = std::upper_bound(_block_ranks.cbegin(), _block_ranks.cend(), position) - 1;
+  auto remaining = position - *block_iter;
+  auto word_index = static_cast<size_t>(std::distance(_block_ranks.cbegin(), block_iter)) * BITMAP_BLOCK_WORDS;
+  while (static_cast<size_t>(__builtin_popcountll(_bitmap[word_index])) <= remaining) {
+    remaining -= __builtin_popcountll(_bitmap[word_index]);
+    ++word_index;
+  }
+
+  // clear the lowest set bits until the requested one is the lowest
+  auto word = _bitmap[word_index];
+  for (; remaining > 0; --remaining) word &= word - 1;
+  return static_cast<ChunkOffset>(word_index * 64 + __builtin_ctzll(word));
+}
+
+std::shared_ptr<PosList> ChunkPosList::to_pos_list() const {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(_size);
+  for_each([&](const size_t, const ChunkOffset chunk_offset) {
+    pos_list->emplace_back(RowID{_chunk_id, chunk_offset});
+  });
+  pos_list->guarantee_single_chunk();
+  return pos_list;
+}
+
+size_t ChunkPosList::estimate_memory_usage() const {
+  return sizeof(*this) + _offsets.capacity() * sizeof(ChunkOffset) + _bitmap.capacity() * sizeof(uint64_t) +
+         _block_ranks.capacity() * sizeof(uint32_t);
+}
+
+std::vector<uint64_t> ChunkPosList::_as_bitmap() const {
+  if (_representation == Representation::Bitmap) return _bitmap;
+
+  auto bitmap = std::vector<uint64_t>((_chunk_size + 63) / 64, 0);
+  for (const auto offset : _offsets) {
+    bitmap[offset / 64] |= uint64_t{1} << (offset % 64);
+  }
+  return bitmap;
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A ChunkPosList stores positions that all lie within a single chunk. It is a compact alternative to a PosList, which
+// needs eight bytes per position. The chunk id is stored once and the positions are held in one of two ways:
+//
+//  - Offsets: a sorted list of 32-bit ChunkOffsets, four bytes per position
+//  - Bitmap: one bit per row of the chunk, i.e., chunk_size / 8 bytes independent of the number of positions
+//
+// make() chooses whichever is smaller for the observed selectivity, which is the bitmap for every selectivity above
+// 1/32. Positions are always in ascending order. Because both representations refer to the same chunk, positions of
+// two lists can be combined with intersect() and unite(), which are bitwise operations for bitmaps.
+class ChunkPosList : private Noncopyable {
+ public:
+  enum class Representation { Offsets, Bitmap };
+
+  // create a list in the given representation, offsets need to be sorted. Use make() to choose automatically.
+  ChunkPosList(const ChunkID chunk_id, const ChunkOffset chunk_size, std::vector<ChunkOffset> offsets);
+  ChunkPosList(const ChunkID chunk_id, const ChunkOffset chunk_size, std::vector<uint64_t> bitmap);
+
+  // creates a list of the given chunk offsets (which need to be sorted) in the chunk chunk_id with chunk_size rows,
+  // using the smaller representation
+  static std::shared_ptr<ChunkPosList> make(const ChunkID chunk_id, const ChunkOffset chunk_size,
+                                            std::vector<ChunkOffset> offsets);
+
+  // creates a list from a bitmap with one bit per row of the chunk (bit i of word i / 64 for offset i)
+  static std::shared_ptr<ChunkPosList> make_from_bitmap(const ChunkID chunk_id, const ChunkOffset chunk_size,
+                                                        std::vector<uint64_t> bitmap);
+
+  // creates a list of all rows of the chunk chunk_id with chunk_size rows
+  static std::shared_ptr<ChunkPosList> make_entire_chunk(const ChunkID chunk_id, const ChunkOffset chunk_size);
+
+  // returns the positions contained in both lists / in at least one list. Both need to reference the same chunk.
+  static std::shared_ptr<ChunkPosList> intersect(const ChunkPosList& lhs, const ChunkPosList& rhs);
+  static std::shared_ptr<ChunkPosList> unite(const ChunkPosList& lhs, const ChunkPosList& rhs);
+
+  ChunkID chunk_id() const;
+
+  // returns the number of rows of the referenced chunk
+  ChunkOffset chunk_size() const;
+
+  // returns the number of positions
+  size_t size() const;
+  bool empty() const;
+
+  Representation representation() const;
+
+  // returns the chunk offset of the position with the given index. For bitmaps, this needs a binary search, so prefer
+  // for_each if you want to access many positions.
+  ChunkOffset operator[](const size_t position) const;
+
+  // calls functor(position, chunk_offset) for all positions in ascending order
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    if (_representation == Representation::Offsets) {
+      for (auto position = size_t{0}; position < _offsets.size(); ++position) {
+        functor(position, _offsets[position]);
+      }
+      return;
+    }
+
+    auto position = size_t{0};
+    for (auto word_index = size_t{0}; word_index < _bitmap.size(); ++word_index) {
+      auto word = _bitmap[word_index];
+      while (word != 0) {
+        const auto bit = static_cast<ChunkOffset>(__builtin_ctzll(word));
+        functor(position++, static_cast<ChunkOffset>(word_index * 64 + bit));
+        word &= word - 1;
+      }
+    }
+  }
+
+  // returns the positions as a PosList, which is guaranteed to reference a single chunk
+  std::shared_ptr<PosList> to_pos_list() const;
+
+  // returns the number of bytes used to store the positions
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // returns the positions as a bitmap, converting them if necessary
+  std::vector<uint64_t> _as_bitmap() const;
+
+  const ChunkID _chunk_id;
+  const ChunkOffset _chunk_size;
+  const Representation _representation;
+  size_t _size = 0;
+
+  std::vector<ChunkOffset> _offsets;
+  std::vector<uint64_t> _bitmap;
+
+  // number of set bits before every block of BITMAP_BLOCK_WORDS words, used to find the n-th position in a bitmap
+  std::vector<uint32_t> _block_ranks;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <set>
@@ -13,6 +14,8 @@
 #include "fitted_attribute_vector.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
@@ -28,6 +31,12 @@ class DictionarySegment : public BaseSegment {
    * Creates a Dictionary segment from a given value segment.
    */
   explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
+    // the values of a ValueSegment of the same type can be encoded without boxing them into AllTypeVariants
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(base_segment)) {
+      encode_values(value_segment->values());
+      return;
+    }
+
     build_dictionary(base_segment);
     auto num_values = base_segment->size();
     initialize_attribute_vector(num_values);
@@ -44,6 +53,7 @@ class DictionarySegment : public BaseSegment {
 
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override {
+    PerformanceWarning("DictionarySegment::operator[]");
     return AllTypeVariant{get(i)};
   }
 
@@ -98,6 +108,11 @@ class DictionarySegment : public BaseSegment {
   // return the number of entries
   size_t size() const override { return _attribute_vector->size(); }
 
+  size_t estimate_memory_usage() const override {
+    return sizeof(*this) + estimate_values_memory_usage(*_dictionary) +
+           _attribute_vector->size() * _attribute_vector->width();
+  }
+
  protected:
   // stores the unique values of the value segment
   std::shared_ptr<std::vector<T>> _dictionary;
@@ -117,6 +132,19 @@ class DictionarySegment : public BaseSegment {
     _dictionary->assign(unique_values.begin(), unique_values.end());
   }
 
+  void encode_values(const std::vector<T>& values) {
+    auto dictionary = values;
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+    _dictionary = std::make_shared<std::vector<T>>(std::move(dictionary));
+
+    initialize_attribute_vector(values.size());
+    for (auto row_index = size_t{0}; row_index < values.size(); ++row_index) {
+      const auto value_iterator = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), values[row_index]);
+      _attribute_vector->set(row_index, ValueID{static_cast<uint32_t>(value_iterator - _dictionary->cbegin())});
+    }
+  }
+
   void initialize_attribute_vector(const size_t segment_size) {
     auto num_distinct_entries = _dictionary->size();
     DebugAssert(num_distinct_entries < static_cast<size_t>(INVALID_VALUE_ID),
@@ -32,9 +32,35 @@ class FittedAttributeVector : public BaseAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const { return AttributeVectorWidth{sizeof(T)}; }
 
+  // returns all value ids. Use this instead of get() in loops, it does not need a virtual call per value.
+  const std::vector<T>& values() const { return _dictionary_references; }
+
  protected:
   std::vector<T> _dictionary_references;
   const T _invalid_id;
 };
 
+/**
+ * Resolves the concrete FittedAttributeVector of an attribute vector and passes its value ids (a std::vector of
+ * uint8_t, uint16_t, or uint32_t) on to a generic lambda.
+ *
+ * Example:
+ *   resolve_attribute_vector_width(*dictionary_segment.attribute_vector(), [&](const auto& value_ids) {
+ *     for (const auto value_id : value_ids) ...
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector_width(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  switch (attribute_vector.width()) {
+    case 1:
+      return func(static_cast<const FittedAttributeVector<uint8_t>&>(attribute_vector).values());
+    case 2:
+      return func(static_cast<const FittedAttributeVector<uint16_t>&>(attribute_vector).values());
+    case 4:
+      return func(static_cast<const FittedAttributeVector<uint32_t>&>(attribute_vector).values());
+    default:
+      Fail("Unknown attribute vector width");
+  }
+}
+
 }  // namespace opossum
@@ -1,8 +1,10 @@
 #include "reference_segment.hpp"
 
 #include <memory>
+#include <mutex>
 
 #include "../utils/assert.hpp"
+#include "../utils/performance_warning.hpp"
 
 namespace opossum {
 
@@ -10,17 +12,39 @@ ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced
                                    const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
     : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {}
 
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const ChunkPosList> chunk_pos_list)
+    : _referenced_table(referenced_table),
+      _referenced_column_id(referenced_column_id),
+      _chunk_pos_list(chunk_pos_list) {}
+
 const AllTypeVariant ReferenceSegment::operator[](const size_t i) const {
-  DebugAssert(i < _pos_list->size(), "Index access out of range!");
-  const auto referenced_row_id = (*_pos_list)[i];
+  PerformanceWarning("ReferenceSegment::operator[]");
+  DebugAssert(i < size(), "Index access out of range!");
+  const auto referenced_row_id =
+      _chunk_pos_list ? RowID{_chunk_pos_list->chunk_id(), (*_chunk_pos_list)[i]} : (*_pos_list)[i];
   const auto& chunk = _referenced_table->get_chunk(referenced_row_id.chunk_id);
   const auto& segment = chunk.get_segment(_referenced_column_id);
   return (*segment)[referenced_row_id.chunk_offset];
 }
 
-size_t ReferenceSegment::size() const { return _pos_list->size(); }
+size_t ReferenceSegment::size() const { return _chunk_pos_list ? _chunk_pos_list->size() : _pos_list->size(); }
+
+size_t ReferenceSegment::estimate_memory_usage() const {
+  // a PosList materialized from the ChunkPosList is not counted, as it only exists for consumers that require it
+  if (_chunk_pos_list) return sizeof(*this) + _chunk_pos_list->estimate_memory_usage();
+  return sizeof(*this) + sizeof(PosList) + _pos_list->capacity() * sizeof(RowID);
+}
+
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const {
+  if (_chunk_pos_list) {
+    std::call_once(_pos_list_materialized, [&]() { _pos_list = _chunk_pos_list->to_pos_list(); });
+  }
+  return _pos_list;
+}
 
-const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
+const std::shared_ptr<const ChunkPosList> ReferenceSegment::chunk_pos_list() const { return _chunk_pos_list; }
 
 const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
 
@@ -2,12 +2,14 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "chunk_pos_list.hpp"
 #include "dictionary_segment.hpp"
 #include "table.hpp"
 #include "types.hpp"
@@ -17,12 +19,15 @@
 namespace opossum {
 
 // ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment
+// The positions are either given as a PosList or, if they all lie in one chunk, as a more compact ChunkPosList.
 class ReferenceSegment : public BaseSegment {
  public:
   // creates a reference segment
   // the parameters specify the positions and the referenced segment
   ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
                    const std::shared_ptr<const PosList> pos);
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const ChunkPosList> chunk_pos_list);
 
   const AllTypeVariant operator[](const size_t i) const override;
 
@@ -30,7 +35,17 @@ class ReferenceSegment : public BaseSegment {
 
   size_t size() const override;
 
+  // Counts the positions, but not the referenced table. ReferenceSegments of the same chunk usually share their
+  // positions, so the estimates of the segments of a chunk add up to a multiple of the memory actually used.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the positions as a PosList. If the segment was created from a ChunkPosList, the PosList is created on the
+  // first call, so consumers that can handle ChunkPosLists should check chunk_pos_list() first.
   const std::shared_ptr<const PosList> pos_list() const;
+
+  // returns the ChunkPosList if the segment was created from one, nullptr otherwise
+  const std::shared_ptr<const ChunkPosList> chunk_pos_list() const;
+
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
@@ -38,7 +53,11 @@ class ReferenceSegment : public BaseSegment {
  protected:
   const std::shared_ptr<const Table> _referenced_table;
   const ColumnID _referenced_column_id;
-  const std::shared_ptr<const PosList> _pos_list;
+  const std::shared_ptr<const ChunkPosList> _chunk_pos_list;
+
+  // created lazily from _chunk_pos_list if necessary
+  mutable std::shared_ptr<const PosList> _pos_list;
+  mutable std::once_flag _pos_list_materialized;
 };
 
 }  // namespace opossum
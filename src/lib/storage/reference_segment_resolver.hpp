@@ -0,0 +1,183 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "reference_segment.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+/**
+ * ReferenceSegment::operator[] looks up the referenced chunk, performs a virtual call, and boxes the value into an
+ * AllTypeVariant - for every single position. The functions in this file resolve a ReferenceSegment in batches
+ * instead:
+ *
+ *  - the positions are grouped by the chunk they reference. If the segment uses a ChunkPosList, or its PosList
+ *    references a single chunk or is clustered by chunk, the groups are simply its runs. Otherwise, the positions are
+ *    grouped by a counting sort over the chunk ids.
+ *  - the type of the referenced segment is resolved once per group, not once per position.
+ *  - the typed values are gathered in a tight loop, prefetching the values of upcoming positions.
+ *
+ * The functor is called with the index of the position in the PosList and the referenced value. Within a group,
+ * positions are visited in ascending order. Runs are visited in the order in which they appear, while the groups of
+ * the counting sort are visited in the order of their chunk ids, so the positions of an unclustered PosList are not
+ * visited in order.
+ *
+ * Example:
+ *   resolve_reference_segment<T>(reference_segment, [&](const size_t position, const T& value) {
+ *     matches[position] = value < search_value;
+ *   });
+ */
+
+namespace opossum {
+
+// number of positions that are prefetched ahead of the current one
+constexpr auto REFERENCE_PREFETCH_DISTANCE = size_t{16};
+
+// if the runs of positions referencing the same chunk are shorter than this on average, the positions are grouped
+constexpr auto MIN_AVERAGE_RUN_LENGTH = size_t{16};
+
+namespace detail {
+
+// Resolves whether referenced_segment is a value or a dictionary segment and calls functor(values, value_at), where
+// value_at(values[chunk_offset]) returns the value at chunk_offset
+template <typename T, typename Functor>
+void resolve_referenced_values(const BaseSegment& referenced_segment, const Functor& functor) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&referenced_segment)) {
+    functor(value_segment->values(), [](const T& value) -> const T& { return value; });
+    return;
+  }
+
+  const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&referenced_segment);
+  Assert(dictionary_segment, "Reference segment does not point to value or dictionary segment");
+  const auto& dictionary = *dictionary_segment->dictionary();
+  resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+    functor(value_ids, [&](const auto value_id) -> const T& { return dictionary[value_id]; });
+  });
+}
+
+// Resolves the positions index_at(0) to index_at(group_size - 1) of pos_list, which all reference referenced_segment
+template <typename T, typename IndexAt, typename Functor>
+void resolve_reference_group(const BaseSegment& referenced_segment, const PosList& pos_list, const size_t group_size,
+                             const IndexAt& index_at, const Functor& functor) {
+  resolve_referenced_values<T>(referenced_segment, [&](const auto& values, const auto& value_at) {
+    for (auto group_index = size_t{0}; group_index < group_size; ++group_index) {
+      if (group_index + REFERENCE_PREFETCH_DISTANCE < group_size) {
+        __builtin_prefetch(&values[pos_list[index_at(group_index + REFERENCE_PREFETCH_DISTANCE)].chunk_offset]);
+      }
+      const auto position = index_at(group_index);
+      functor(position, value_at(values[pos_list[position].chunk_offset]));
+    }
+  });
+}
+
+}  // namespace detail
+
+// Calls functor(position, value) for every position of the reference segment, see above
+template <typename T, typename Functor>
+void resolve_reference_segment(const ReferenceSegment& segment, const Functor& functor) {
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+  const auto referenced_segment = [&](const ChunkID chunk_id) -> const BaseSegment& {
+    return *referenced_table.get_chunk(chunk_id).get_segment(referenced_column_id);
+  };
+
+  // the positions of a ChunkPosList are sorted and reference a single chunk, so they form a single group
+  if (const auto chunk_pos_list = segment.chunk_pos_list()) {
+    if (chunk_pos_list->empty()) return;
+    detail::resolve_referenced_values<T>(
+        referenced_segment(chunk_pos_list->chunk_id()), [&](const auto& values, const auto& value_at) {
+          chunk_pos_list->for_each([&](const size_t position, const ChunkOffset chunk_offset) {
+            functor(position, value_at(values[chunk_offset]));
+          });
+        });
+    return;
+  }
+
+  const auto& pos_list = *segment.pos_list();
+  if (pos_list.empty()) return;
+
+  if (pos_list.references_single_chunk()) {
+    detail::resolve_reference_group<T>(
+        referenced_segment(pos_list.front().chunk_id), pos_list, pos_list.size(),
+        [](const size_t group_index) { return group_index; }, functor);
+    return;
+  }
+
+  auto run_count = size_t{1};
+  for (auto position = size_t{1}; position < pos_list.size(); ++position) {
+    run_count += pos_list[position].chunk_id != pos_list[position - 1].chunk_id;
+  }
+
+  if (run_count * MIN_AVERAGE_RUN_LENGTH <= pos_list.size()) {
+    // the positions are clustered by chunk, so every run is a group
+    auto run_begin = size_t{0};
+    while (run_begin < pos_list.size()) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+
+      detail::resolve_reference_group<T>(
+          referenced_segment(chunk_id), pos_list, run_end - run_begin,
+          [&](const size_t group_index) { return run_begin + group_index; }, functor);
+      run_begin = run_end;
+    }
+    return;
+  }
+
+  // otherwise, group the positions by chunk with a counting sort
+  const auto chunk_count = static_cast<size_t>(referenced_table.chunk_count());
+  auto group_begins = std::vector<size_t>(chunk_count + 1, 0);
+  for (const auto& row_id : pos_list) {
+    ++group_begins[row_id.chunk_id + 1];
+  }
+  for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+    group_begins[chunk_id + 1] += group_begins[chunk_id];
+  }
+
+  auto grouped_positions = std::vector<size_t>(pos_list.size());
+  auto write_offsets = std::vector<size_t>(group_begins.cbegin(), group_begins.cend() - 1);
+  for (auto position = size_t{0}; position < pos_list.size(); ++position) {
+    grouped_positions[write_offsets[pos_list[position].chunk_id]++] = position;
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto group_begin = group_begins[chunk_id];
+    const auto group_size = group_begins[chunk_id + 1] - group_begin;
+    if (group_size == 0) continue;
+
+    detail::resolve_reference_group<T>(
+        referenced_segment(chunk_id), pos_list, group_size,
+        [&](const size_t group_index) { return grouped_positions[group_begin + group_index]; }, functor);
+  }
+}
+
+// Calls functor(position, value) for every value of a value, dictionary, or reference segment. Value and dictionary
+// segments are visited in order, reference segments as described above.
+template <typename T, typename Functor>
+void resolve_segment_values(const BaseSegment& segment, const Functor& functor) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& values = value_segment->values();
+    for (auto position = size_t{0}; position < values.size(); ++position) {
+      functor(position, values[position]);
+    }
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    resolve_attribute_vector_width(*dictionary_segment->attribute_vector(), [&](const auto& value_ids) {
+      for (auto position = size_t{0}; position < value_ids.size(); ++position) {
+        functor(position, dictionary[value_ids[position]]);
+      }
+    });
+  } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    resolve_reference_segment<T>(*reference_segment, functor);
+  } else {
+    Fail("Segment and data type do not match");
+  }
+}
+
+}  // namespace opossum
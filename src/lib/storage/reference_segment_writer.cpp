@@ -0,0 +1,172 @@
+#include "reference_segment_writer.hpp"
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "chunk_pos_list.hpp"
+#include "reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ReferenceSegmentWriter::ReferenceSegmentWriter(const std::shared_ptr<const Table> input_table)
+    : _input_table(input_table) {
+  const auto column_count = _input_table->column_count();
+  const auto chunk_count = _input_table->chunk_count();
+  if (column_count == 0) return;
+
+  const auto first_segment = _input_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  _input_is_reference = static_cast<bool>(std::dynamic_pointer_cast<const ReferenceSegment>(first_segment));
+  if (!_input_is_reference) return;
+
+  // Two columns belong to the same group if their segments share the positions in every chunk. Segments that were
+  // created from a ChunkPosList are identified by it, since every one of them materializes its own PosList. Nothing is
+  // materialized here, as pos_list() only returns the PosList of the other segments.
+  auto groups_by_positions = std::map<std::vector<const void*>, size_t>{};
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto positions_key = std::vector<const void*>{};
+    positions_key.reserve(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(_input_table->get_chunk(chunk_id).get_segment(column_id));
+      Assert(segment, "Input table mixes reference and data segments");
+
+      if (chunk_id == 0) {
+        _referenced_tables.emplace_back(segment->referenced_table());
+        _referenced_column_ids.emplace_back(segment->referenced_column_id());
+      } else {
+        Assert(segment->referenced_table() == _referenced_tables.back() &&
+                   segment->referenced_column_id() == _referenced_column_ids.back(),
+               "Segments of a column reference different columns");
+      }
+
+      const auto chunk_pos_list = segment->chunk_pos_list();
+      positions_key.emplace_back(chunk_pos_list ? static_cast<const void*>(chunk_pos_list.get())
+                                                : static_cast<const void*>(segment->pos_list().get()));
+    }
+
+    const auto [group_iter, inserted] = groups_by_positions.emplace(positions_key, _group_columns.size());  // NOLINT
+    _column_groups.emplace_back(group_iter->second);
+    if (!inserted) continue;
+
+    _group_columns.emplace_back(column_id);
+    _group_pos_lists.emplace_back(chunk_count);
+  }
+}
+
+void ReferenceSegmentWriter::write(Chunk& output_chunk, const std::shared_ptr<const PosList>& positions) const {
+  const auto column_count = _input_table->column_count();
+
+  if (!_input_is_reference) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(_input_table, column_id, positions));
+    }
+    return;
+  }
+
+  // resolve the positions once per group
+  auto resolved_positions = std::vector<std::shared_ptr<PosList>>(_group_columns.size());
+  for (auto group = size_t{0}; group < _group_columns.size(); ++group) {
+    const auto group_column_id = _group_columns[group];
+    auto& pos_lists = _group_pos_lists[group];
+    auto& resolved = resolved_positions[group];
+    resolved = std::make_shared<PosList>();
+    resolved->reserve(positions->size());
+
+    // The PosList of an input chunk is looked up when a write() first reads the chunk. Only then it is materialized if
+    // it was created from a ChunkPosList, the segment keeps it alive. Concurrent calls may look it up twice.
+    const auto pos_list_of_chunk = [&](const ChunkID chunk_id) -> const PosList& {
+      auto pos_list = pos_lists[chunk_id].load(std::memory_order_acquire);
+      if (!pos_list) {
+        const auto& segment = *_input_table->get_chunk(chunk_id).get_segment(group_column_id);
+        pos_list = static_cast<const ReferenceSegment&>(segment).pos_list().get();
+        pos_lists[chunk_id].store(pos_list, std::memory_order_release);
+      }
+      return *pos_list;
+    };
+
+    for (const auto& row_id : *positions) {
+      resolved->emplace_back(pos_list_of_chunk(row_id.chunk_id)[row_id.chunk_offset]);
+    }
+
+    // positions in a single input chunk that references a single chunk still reference a single chunk
+    if (positions->references_single_chunk() && !positions->empty() &&
+        pos_list_of_chunk(positions->front().chunk_id).references_single_chunk()) {
+      resolved->guarantee_single_chunk();
+    }
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& resolved = resolved_positions[_column_groups[column_id]];
+    output_chunk.add_segment(
+        std::make_shared<ReferenceSegment>(_referenced_tables[column_id], _referenced_column_ids[column_id], resolved));
+  }
+}
+
+void ReferenceSegmentWriter::write_subset(Chunk& output_chunk, const Chunk& input_chunk,
+                                          const std::vector<ChunkOffset>& offsets) {
+  auto chunk_pos_list_subsets = std::map<const ChunkPosList*, std::shared_ptr<const ChunkPosList>>{};
+  auto pos_list_subsets = std::map<const PosList*, std::shared_ptr<const PosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < input_chunk.column_count(); ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_chunk.get_segment(column_id));
+    Assert(segment, "Input chunk mixes reference and data segments");
+
+    if (const auto chunk_pos_list = segment->chunk_pos_list()) {
+      auto& subset = chunk_pos_list_subsets[chunk_pos_list.get()];
+      if (!subset) {
+        auto subset_offsets = std::vector<ChunkOffset>{};
+        subset_offsets.reserve(offsets.size());
+        auto next_offset = offsets.cbegin();
+        chunk_pos_list->for_each([&](const size_t position, const ChunkOffset chunk_offset) {
+          if (next_offset == offsets.cend() || *next_offset != position) return;
+          subset_offsets.emplace_back(chunk_offset);
+          ++next_offset;
+        });
+        subset =
+            ChunkPosList::make(chunk_pos_list->chunk_id(), chunk_pos_list->chunk_size(), std::move(subset_offsets));
+      }
+      output_chunk.add_segment(
+          std::make_shared<ReferenceSegment>(segment->referenced_table(), segment->referenced_column_id(), subset));
+      continue;
+    }
+
+    const auto pos_list = segment->pos_list();
+    auto& subset = pos_list_subsets[pos_list.get()];
+    if (!subset) {
+      auto positions = std::make_shared<PosList>();
+      positions->reserve(offsets.size());
+      for (const auto offset : offsets) positions->emplace_back((*pos_list)[offset]);
+
+      // a subset of positions that reference a single chunk still references that chunk only
+      if (pos_list->references_single_chunk()) positions->guarantee_single_chunk();
+      subset = positions;
+    }
+    output_chunk.add_segment(
+        std::make_shared<ReferenceSegment>(segment->referenced_table(), segment->referenced_column_id(), subset));
+  }
+}
+
+void ReferenceSegmentWriter::write_subset(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                                          const ChunkID chunk_id, std::vector<ChunkOffset> offsets) {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  if (input_chunk.column_count() == 0) return;
+
+  if (std::dynamic_pointer_cast<const ReferenceSegment>(input_chunk.get_segment(ColumnID{0}))) {
+    write_subset(output_chunk, input_chunk, offsets);
+    return;
+  }
+
+  // the offsets are stored as a list or as a bitmap, whichever is smaller
+  const auto chunk_pos_list =
+      ChunkPosList::make(chunk_id, static_cast<ChunkOffset>(input_chunk.size()), std::move(offsets));
+  for (auto column_id = ColumnID{0}; column_id < input_chunk.column_count(); ++column_id) {
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, chunk_pos_list));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "chunk.hpp"
+#include "table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operators like joins produce positions into their input tables. If an input table consists of ReferenceSegments
+// itself, the output must not reference it (we never reference references), but the tables that it references.
+// The ReferenceSegmentWriter takes care of this: it creates ReferenceSegments for all columns of the input table that
+// point to the original tables.
+//
+// Columns of a reference input usually share their positions (e.g., all columns of a TableScan output). Such columns
+// are grouped in the constructor, so that the positions are resolved only once per group when writing a chunk. Input
+// segments that were created from a ChunkPosList are only materialized when write() reads their chunk.
+//
+// write() is const and can be called concurrently, e.g., by the tasks that produce different output chunks.
+class ReferenceSegmentWriter : private Noncopyable {
+ public:
+  explicit ReferenceSegmentWriter(const std::shared_ptr<const Table> input_table);
+
+  // adds one ReferenceSegment per column of the input table to output_chunk, which references the rows of the input
+  // table at the given positions
+  void write(Chunk& output_chunk, const std::shared_ptr<const PosList>& positions) const;
+
+  // Adds one ReferenceSegment per column of input_chunk, which consists of ReferenceSegments, to output_chunk. They
+  // reference the rows of the input chunk at the given ascending offsets, i.e., a subset of what it references.
+  // Segments that share their positions still share them afterwards, and ChunkPosLists stay ChunkPosLists.
+  static void write_subset(Chunk& output_chunk, const Chunk& input_chunk, const std::vector<ChunkOffset>& offsets);
+
+  // Same as above for a chunk of the input table that may also consist of data segments. These are referenced with a
+  // ChunkPosList of the offsets that is shared by all columns.
+  static void write_subset(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                           std::vector<ChunkOffset> offsets);
+
+ protected:
+  const std::shared_ptr<const Table> _input_table;
+
+  // whether the input table consists of ReferenceSegments
+  bool _input_is_reference = false;
+
+  // for reference inputs: the group of every column, and the first column of every group, whose segments are used to
+  // resolve the positions of the group
+  std::vector<size_t> _column_groups;
+  std::vector<ColumnID> _group_columns;
+
+  // for reference inputs: the PosList of every group in every chunk, which write() looks up when it first reads the
+  // chunk, so that a writer looks up every PosList only once
+  mutable std::vector<std::vector<std::atomic<const PosList*>>> _group_pos_lists;
+
+  // for reference inputs: the table and column that every column references
+  std::vector<std::shared_ptr<const Table>> _referenced_tables;
+  std::vector<ColumnID> _referenced_column_ids;
+};
+
+}  // namespace opossum
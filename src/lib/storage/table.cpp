@@ -13,6 +13,7 @@
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracer.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
@@ -63,6 +64,16 @@ void Table::create_new_chunk() {
   emplace_chunk(new_chunk);
 }
 
+void Table::create_empty_chunks(const ChunkID chunk_count) {
+  Assert(row_count() == 0, "Only tables without rows can be replaced by empty chunks");
+  _chunks.clear();
+  _chunk_compression_status.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    _chunks.emplace_back(std::make_shared<Chunk>());
+    _chunk_compression_status.emplace_back(false);
+  }
+}
+
 uint64_t Table::row_count() const {
   uint64_t num_rows = 0;
   for (auto& chunk : _chunks) {
@@ -77,6 +88,16 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const { return
 
 uint32_t Table::chunk_size() const { return _chunk_size; }
 
+size_t Table::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+  for (const auto& chunk : _chunks) {
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      bytes += chunk->get_segment(column_id)->estimate_memory_usage();
+    }
+  }
+  return bytes;
+}
+
 const std::vector<std::string>& Table::column_names() const { return _column_names; }
 
 const std::string& Table::column_name(ColumnID column_id) const { return _column_names.at(column_id); }
@@ -89,6 +110,7 @@ const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunks.at(chunk
 
 void Table::compress_chunk(ChunkID chunk_id) {
   Assert(chunk_id < _chunks.size() - 1, "Only immutable chunks can be compressed (last chunk ist mutable).");
+  const auto trace_scope = Tracer::Scope{"storage", "compress_chunk", "chunk_id", chunk_id};
   {
     auto guard = std::lock_guard(_chunk_compression_mutex);
     if (_chunk_compression_status[chunk_id]) {
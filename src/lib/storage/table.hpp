@@ -67,6 +67,9 @@ class Table : private Noncopyable {
   // return the maximum chunk size (cannot exceed ChunkOffset (uint32_t))
   uint32_t chunk_size() const;
 
+  // returns the (approximate) number of bytes used by the segments of the table, see BaseSegment
+  size_t estimate_memory_usage() const;
+
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
@@ -84,6 +87,10 @@ class Table : private Noncopyable {
   // creates a new chunk and appends it
   void create_new_chunk();
 
+  // Replaces the chunks of a table without rows by chunk_count chunks without segments. Their segments can then be
+  // added through get_chunk, concurrently for different chunks, e.g., by an operator that processes chunks in parallel.
+  void create_empty_chunks(const ChunkID chunk_count);
+
   // compresses a ValueSegment into a DictionarySegment
   void compress_chunk(ChunkID chunk_id);
 
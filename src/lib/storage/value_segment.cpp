@@ -13,9 +13,12 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T> values) : _data(std::move(values)) {}
+
 template <typename T>
 const AllTypeVariant ValueSegment<T>::operator[](const size_t offset) const {
-  PerformanceWarning("operator[] used");
+  PerformanceWarning("ValueSegment::operator[]");
   return AllTypeVariant{_data.at(offset)};
 }
 
@@ -29,6 +32,11 @@ size_t ValueSegment<T>::size() const {
   return _data.size();
 }
 
+template <typename T>
+size_t ValueSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + estimate_values_memory_usage(_data);
+}
+
 template <typename T>
 const std::vector<T>& ValueSegment<T>::values() const {
   return _data;
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -9,10 +11,32 @@
 
 namespace opossum {
 
+// returns the number of bytes allocated for the values, including the heap memory of strings that are too long for
+// the small string optimization
+template <typename T>
+size_t estimate_values_memory_usage(const std::vector<T>& values) {
+  auto bytes = values.capacity() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : values) {
+      // short strings store their characters within the string object itself
+      const auto object = reinterpret_cast<const char*>(&value);
+      const auto is_short = !std::less<const char*>{}(value.data(), object) &&
+                            std::less<const char*>{}(value.data(), object + sizeof(std::string));
+      if (!is_short) bytes += value.capacity() + 1;
+    }
+  }
+  return bytes;
+}
+
 // ValueSegment is a segment type that stores all its values in a vector
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  ValueSegment() = default;
+
+  // creates a segment that holds the given values, e.g., the results of an operator
+  explicit ValueSegment(std::vector<T> values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t offset) const override;
 
@@ -22,6 +46,8 @@ class ValueSegment : public BaseSegment {
   // return the number of entries
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
@@ -0,0 +1,349 @@
+#include "tpch_queries.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/multi_predicate_scan.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+// An operator together with the names of its output columns, so that the plans can refer to columns by name while
+// they are built, i.e., before any operator has been executed
+struct PlanNode {
+  std::shared_ptr<AbstractOperator> op;
+  std::vector<std::string> column_names;
+
+  ColumnID column_id(const std::string& column_name) const {
+    const auto iterator = std::find(column_names.cbegin(), column_names.cend(), column_name);
+    Assert(iterator != column_names.cend(), "Unknown column " + column_name);
+    return ColumnID{static_cast<uint16_t>(std::distance(column_names.cbegin(), iterator))};
+  }
+
+  ExpressionPointer column(const std::string& column_name) const { return column_(column_id(column_name)); }
+};
+
+PlanNode get_table(const std::string& table_name) {
+  return {std::make_shared<GetTable>(table_name), StorageManager::get().get_table(table_name)->column_names()};
+}
+
+PlanNode scan(const PlanNode& input, const std::string& column_name, const ScanType scan_type,
+              const AllTypeVariant& value) {
+  return {std::make_shared<TableScan>(input.op, input.column_id(column_name), scan_type, value), input.column_names};
+}
+
+// filters by a conjunction of predicates of the form <column> <scan_type> <value>
+PlanNode scan_all(const PlanNode& input,
+                  const std::vector<std::tuple<std::string, ScanType, AllTypeVariant>>& predicates) {
+  auto scan_predicates = std::vector<ScanPredicate>{};
+  for (const auto& [column_name, scan_type, value] : predicates) {
+    scan_predicates.emplace_back(ScanPredicate{input.column_id(column_name), scan_type, value});
+  }
+  return {std::make_shared<MultiPredicateScan>(input.op, std::move(scan_predicates)), input.column_names};
+}
+
+// the rows of both inputs, which have to be scans of the same input
+PlanNode union_positions(const PlanNode& left, const PlanNode& right) {
+  return {std::make_shared<UnionPositions>(left.op, right.op), left.column_names};
+}
+
+// Drops the rows of the scan whose value in column_name does not occur in build_column_name of build, i.e., the rows
+// that cannot find a partner in a join with build. As a RuntimeFilter is used, some of them may remain.
+void add_runtime_filter(const PlanNode& scan, const PlanNode& build, const std::string& column_name,
+                        const std::string& build_column_name) {
+  const auto build_column_id = build.column_id(build_column_name);
+  const auto column_id = scan.column_id(column_name);
+  if (const auto table_scan = std::dynamic_pointer_cast<TableScan>(scan.op)) {
+    table_scan->set_runtime_filter(build.op, build_column_id, column_id);
+    return;
+  }
+  const auto multi_predicate_scan = std::dynamic_pointer_cast<MultiPredicateScan>(scan.op);
+  Assert(multi_predicate_scan, "Runtime filters can only be added to scans");
+  multi_predicate_scan->set_runtime_filter(build.op, build_column_id, column_id);
+}
+
+// If runtime_filter is set, right needs to be a scan, which drops most rows without a partner in left already.
+PlanNode join(const PlanNode& left, const PlanNode& right, const std::string& left_column_name,
+              const std::string& right_column_name, const bool runtime_filter = false) {
+  if (runtime_filter) add_runtime_filter(right, left, right_column_name, left_column_name);
+
+  auto column_names = left.column_names;
+  column_names.insert(column_names.end(), right.column_names.cbegin(), right.column_names.cend());
+  const auto column_ids = std::make_pair(left.column_id(left_column_name), right.column_id(right_column_name));
+  return {std::make_shared<JoinHash>(left.op, right.op, column_ids), column_names};
+}
+
+// computes the given expressions, which are named by the plan (not by the operator)
+PlanNode project(const PlanNode& input, const std::vector<std::pair<std::string, ExpressionPointer>>& expressions) {
+  auto column_names = std::vector<std::string>{};
+  auto projected_expressions = std::vector<ExpressionPointer>{};
+  for (const auto& [column_name, expression] : expressions) {
+    column_names.emplace_back(column_name);
+    projected_expressions.emplace_back(expression);
+  }
+  return {std::make_shared<Projection>(input.op, std::move(projected_expressions)), column_names};
+}
+
+// An aggregate of a plan: the function, its input column (none for COUNT(*)), and the name of its output column
+struct PlanAggregate {
+  AggregateFunction function;
+  std::optional<std::string> column_name;
+  std::string output_column_name;
+};
+
+PlanNode aggregate(const PlanNode& input, const std::vector<std::string>& group_by_column_names,
+                   const std::vector<PlanAggregate>& aggregates) {
+  auto column_names = group_by_column_names;
+  auto group_by_column_ids = std::vector<ColumnID>{};
+  for (const auto& column_name : group_by_column_names) group_by_column_ids.emplace_back(input.column_id(column_name));
+
+  auto aggregate_definitions = std::vector<AggregateDefinition>{};
+  for (const auto& plan_aggregate : aggregates) {
+    auto column_id = std::optional<ColumnID>{};
+    if (plan_aggregate.column_name) column_id = input.column_id(*plan_aggregate.column_name);
+    aggregate_definitions.emplace_back(AggregateDefinition{column_id, plan_aggregate.function});
+    column_names.emplace_back(plan_aggregate.output_column_name);
+  }
+  return {std::make_shared<Aggregate>(input.op, std::move(aggregate_definitions), std::move(group_by_column_ids)),
+          column_names};
+}
+
+// sorts by the given columns, the first one is the most significant
+PlanNode sort(const PlanNode& input, const std::vector<std::pair<std::string, OrderByMode>>& order_by) {
+  auto node = input;
+  for (auto order_by_column = order_by.crbegin(); order_by_column != order_by.crend(); ++order_by_column) {
+    node.op = std::make_shared<Sort>(node.op, node.column_id(order_by_column->first), order_by_column->second);
+  }
+  return node;
+}
+
+// returns the first k rows of the input sorted by the given columns, the first one is the most significant
+PlanNode top_k(const PlanNode& input, const std::vector<std::pair<std::string, OrderByMode>>& order_by,
+               const size_t k) {
+  // ties of the first column are ordered by the position in the input, i.e., by the other columns
+  const auto secondary_order_by = std::vector<std::pair<std::string, OrderByMode>>(order_by.cbegin() + 1,
+                                                                                     order_by.cend());
+  auto node = sort(input, secondary_order_by);
+  const auto& [column_name, order_by_mode] = order_by.front();
+  node.op = std::make_shared<TopK>(node.op, node.column_id(column_name), k, order_by_mode);
+  return node;
+}
+
+constexpr auto Ascending = OrderByMode::Ascending;
+constexpr auto Descending = OrderByMode::Descending;
+
+// l_extendedprice * (1 - l_discount)
+ExpressionPointer discounted_price(const PlanNode& node) {
+  return mul_(node.column("l_extendedprice"), sub_(1.0, node.column("l_discount")));
+}
+
+// Pricing Summary Report
+PlanNode query_1() {
+  const auto lineitem =
+      scan(get_table("lineitem"), "l_shipdate", ScanType::OpLessThanEquals, std::string{"1998-09-02"});
+
+  const auto projection =
+      project(lineitem, {{"l_returnflag", lineitem.column("l_returnflag")},
+                         {"l_linestatus", lineitem.column("l_linestatus")},
+                         {"l_quantity", lineitem.column("l_quantity")},
+                         {"l_extendedprice", lineitem.column("l_extendedprice")},
+                         {"l_discount", lineitem.column("l_discount")},
+                         {"disc_price", discounted_price(lineitem)},
+                         {"charge", mul_(discounted_price(lineitem), add_(1.0, lineitem.column("l_tax")))}});
+
+  const auto aggregated = aggregate(projection, {"l_returnflag", "l_linestatus"},
+                                    {{AggregateFunction::Sum, "l_quantity", "sum_qty"},
+                                     {AggregateFunction::Sum, "l_extendedprice", "sum_base_price"},
+                                     {AggregateFunction::Sum, "disc_price", "sum_disc_price"},
+                                     {AggregateFunction::Sum, "charge", "sum_charge"},
+                                     {AggregateFunction::Avg, "l_quantity", "avg_qty"},
+                                     {AggregateFunction::Avg, "l_extendedprice", "avg_price"},
+                                     {AggregateFunction::Avg, "l_discount", "avg_disc"},
+                                     {AggregateFunction::Count, std::nullopt, "count_order"}});
+
+  return sort(aggregated, {{"l_returnflag", Ascending}, {"l_linestatus", Ascending}});
+}
+
+// Shipping Priority
+PlanNode query_3(const bool runtime_filters) {
+  const auto customer = scan(get_table("customer"), "c_mktsegment", ScanType::OpEquals, std::string{"BUILDING"});
+  const auto orders = scan(get_table("orders"), "o_orderdate", ScanType::OpLessThan, std::string{"1995-03-15"});
+  const auto lineitem = scan(get_table("lineitem"), "l_shipdate", ScanType::OpGreaterThan, std::string{"1995-03-15"});
+
+  const auto customer_orders = join(customer, orders, "c_custkey", "o_custkey", runtime_filters);
+  const auto joined = join(customer_orders, lineitem, "o_orderkey", "l_orderkey", runtime_filters);
+
+  const auto projection = project(joined, {{"l_orderkey", joined.column("l_orderkey")},
+                                           {"o_orderdate", joined.column("o_orderdate")},
+                                           {"o_shippriority", joined.column("o_shippriority")},
+                                           {"revenue", discounted_price(joined)}});
+  const auto aggregated = aggregate(projection, {"l_orderkey", "o_orderdate", "o_shippriority"},
+                                    {{AggregateFunction::Sum, "revenue", "revenue"}});
+
+  return top_k(aggregated, {{"revenue", Descending}, {"o_orderdate", Ascending}}, 10);
+}
+
+// Local Supplier Volume
+PlanNode query_5(const bool runtime_filters) {
+  const auto region = scan(get_table("region"), "r_name", ScanType::OpEquals, std::string{"ASIA"});
+  const auto orders =
+      scan_all(get_table("orders"), {{"o_orderdate", ScanType::OpGreaterThanEquals, std::string{"1994-01-01"}},
+                                     {"o_orderdate", ScanType::OpLessThan, std::string{"1995-01-01"}}});
+
+  const auto nation = join(region, get_table("nation"), "r_regionkey", "n_regionkey");
+  const auto customer = join(nation, get_table("customer"), "n_nationkey", "c_nationkey");
+  const auto customer_orders = join(customer, orders, "c_custkey", "o_custkey", runtime_filters);
+  const auto lineitem = join(customer_orders, get_table("lineitem"), "o_orderkey", "l_orderkey");
+  const auto supplier = join(lineitem, get_table("supplier"), "l_suppkey", "s_suppkey");
+
+  // c_nationkey = s_nationkey
+  const auto projection = project(supplier, {{"n_name", supplier.column("n_name")},
+                                             {"revenue", discounted_price(supplier)},
+                                             {"same_nation", equals_(supplier.column("c_nationkey"),
+                                                                     supplier.column("s_nationkey"))}});
+  const auto same_nation = scan(projection, "same_nation", ScanType::OpEquals, 1);
+
+  const auto aggregated = aggregate(same_nation, {"n_name"}, {{AggregateFunction::Sum, "revenue", "revenue"}});
+  return sort(aggregated, {{"revenue", Descending}});
+}
+
+// Forecasting Revenue Change
+PlanNode query_6() {
+  const auto lineitem =
+      scan_all(get_table("lineitem"), {{"l_shipdate", ScanType::OpGreaterThanEquals, std::string{"1994-01-01"}},
+                                       {"l_shipdate", ScanType::OpLessThan, std::string{"1995-01-01"}},
+                                       {"l_discount", ScanType::OpGreaterThanEquals, 0.05},
+                                       {"l_discount", ScanType::OpLessThanEquals, 0.07},
+                                       {"l_quantity", ScanType::OpLessThan, 24.0}});
+
+  const auto projection =
+      project(lineitem, {{"revenue", mul_(lineitem.column("l_extendedprice"), lineitem.column("l_discount"))}});
+  return aggregate(projection, {}, {{AggregateFunction::Sum, "revenue", "revenue"}});
+}
+
+// Returned Item Reporting
+PlanNode query_10(const bool runtime_filters) {
+  const auto orders =
+      scan_all(get_table("orders"), {{"o_orderdate", ScanType::OpGreaterThanEquals, std::string{"1993-10-01"}},
+                                     {"o_orderdate", ScanType::OpLessThan, std::string{"1994-01-01"}}});
+  const auto lineitem = scan(get_table("lineitem"), "l_returnflag", ScanType::OpEquals, std::string{"R"});
+
+  const auto customer_orders = join(get_table("customer"), orders, "c_custkey", "o_custkey");
+  const auto customer_lineitem = join(customer_orders, lineitem, "o_orderkey", "l_orderkey", runtime_filters);
+  const auto joined = join(customer_lineitem, get_table("nation"), "c_nationkey", "n_nationkey");
+
+  const auto group_by_column_names =
+      std::vector<std::string>{"c_custkey", "c_name", "c_acctbal", "c_phone", "n_name", "c_address", "c_comment"};
+  auto expressions = std::vector<std::pair<std::string, ExpressionPointer>>{};
+  for (const auto& column_name : group_by_column_names) {
+    expressions.emplace_back(column_name, joined.column(column_name));
+  }
+  expressions.emplace_back("revenue", discounted_price(joined));
+
+  const auto aggregated = aggregate(project(joined, expressions), group_by_column_names,
+                                    {{AggregateFunction::Sum, "revenue", "revenue"}});
+  return top_k(aggregated, {{"revenue", Descending}}, 20);
+}
+
+// Shipping Modes and Order Priority
+PlanNode query_12() {
+  const auto lineitem_table = get_table("lineitem");
+  const auto ship_modes = union_positions(scan(lineitem_table, "l_shipmode", ScanType::OpEquals, std::string{"MAIL"}),
+                                          scan(lineitem_table, "l_shipmode", ScanType::OpEquals, std::string{"SHIP"}));
+  const auto received =
+      scan_all(ship_modes, {{"l_receiptdate", ScanType::OpGreaterThanEquals, std::string{"1994-01-01"}},
+                            {"l_receiptdate", ScanType::OpLessThan, std::string{"1995-01-01"}}});
+
+  // l_commitdate < l_receiptdate AND l_shipdate < l_commitdate
+  const auto dates = project(received, {{"l_orderkey", received.column("l_orderkey")},
+                                        {"l_shipmode", received.column("l_shipmode")},
+                                        {"committed", less_than_(received.column("l_commitdate"),
+                                                                 received.column("l_receiptdate"))},
+                                        {"shipped", less_than_(received.column("l_shipdate"),
+                                                               received.column("l_commitdate"))}});
+  const auto lineitem = scan_all(dates, {{"committed", ScanType::OpEquals, 1}, {"shipped", ScanType::OpEquals, 1}});
+
+  const auto joined = join(get_table("orders"), lineitem, "o_orderkey", "l_orderkey");
+
+  // o_orderpriority = '1-URGENT' OR o_orderpriority = '2-HIGH'
+  const auto high_priority = add_(equals_(joined.column("o_orderpriority"), std::string{"1-URGENT"}),
+                                  equals_(joined.column("o_orderpriority"), std::string{"2-HIGH"}));
+  const auto projection = project(joined, {{"l_shipmode", joined.column("l_shipmode")},
+                                           {"high_line", high_priority},
+                                           {"low_line", sub_(1, high_priority)}});
+
+  const auto aggregated = aggregate(projection, {"l_shipmode"},
+                                    {{AggregateFunction::Sum, "high_line", "high_line_count"},
+                                     {AggregateFunction::Sum, "low_line", "low_line_count"}});
+  return sort(aggregated, {{"l_shipmode", Ascending}});
+}
+
+// Promotion Effect
+PlanNode query_14() {
+  const auto lineitem =
+      scan_all(get_table("lineitem"), {{"l_shipdate", ScanType::OpGreaterThanEquals, std::string{"1995-09-01"}},
+                                       {"l_shipdate", ScanType::OpLessThan, std::string{"1995-10-01"}}});
+  const auto joined = join(lineitem, get_table("part"), "l_partkey", "p_partkey");
+
+  // p_type LIKE 'PROMO%'
+  const auto is_promotion = mul_(greater_than_equals_(joined.column("p_type"), std::string{"PROMO"}),
+                                 less_than_(joined.column("p_type"), std::string{"PROMP"}));
+  const auto projection = project(joined, {{"revenue", discounted_price(joined)},
+                                           {"promo_revenue", mul_(discounted_price(joined), is_promotion)}});
+
+  const auto aggregated = aggregate(projection, {}, {{AggregateFunction::Sum, "promo_revenue", "promo_revenue"},
+                                                     {AggregateFunction::Sum, "revenue", "revenue"}});
+  return project(aggregated, {{"promo_revenue", div_(mul_(100.0, aggregated.column("promo_revenue")),
+                                                     aggregated.column("revenue"))}});
+}
+
+}  // namespace
+
+const std::vector<size_t>& TpchQueries::query_ids() {
+  static const auto query_ids = std::vector<size_t>{1, 3, 5, 6, 10, 12, 14};
+  return query_ids;
+}
+
+std::shared_ptr<AbstractOperator> TpchQueries::build_plan(const size_t query_id, const bool runtime_filters) {
+  switch (query_id) {
+    case 1:
+      return query_1().op;
+    case 3:
+      return query_3(runtime_filters).op;
+    case 5:
+      return query_5(runtime_filters).op;
+    case 6:
+      return query_6().op;
+    case 10:
+      return query_10(runtime_filters).op;
+    case 12:
+      return query_12().op;
+    case 14:
+      return query_14().op;
+  }
+  Fail("TPC-H query " + std::to_string(query_id) + " is not supported");
+  return nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Operator plans of the TPC-H queries that our operators can express: 1, 3, 5, 6, 10, 12, and 14. They use the
+// substitution parameters of the query validation in the specification. As there is no optimizer, the plans are
+// written the way an optimizer would plan them: predicates are pushed down to the tables, and hash joins are used for
+// all equi-joins. Features that the operators lack are expressed with the available ones:
+//  - ORDER BY multiple columns sorts by the least significant one first, which the stable Sort keeps
+//  - ORDER BY ... LIMIT becomes a TopK, after sorting by the less significant columns
+//  - IN becomes a UnionPositions of scans
+//  - predicates and CASE expressions that compare columns with each other become comparisons in a Projection, which
+//    evaluate to 0 or 1, e.g., CASE WHEN a < b THEN x ELSE 0 END becomes x * (a < b)
+//  - LIKE 'PROMO%' becomes the range 'PROMO' <= p_type < 'PROMP'
+//
+// With runtime filters, the scans on the probe side of the joins of queries 3, 5, and 10 drop most rows that cannot
+// find a join partner (see RuntimeFilter), so that fewer rows reach the joins. This does not change the results.
+//
+// The plans read the tables through GetTable, so the tables need to be in the StorageManager (see
+// TpchTableGenerator::generate_and_store) when a plan is built. Every call builds a new plan, as operators can only be
+// executed once.
+class TpchQueries : private Noncopyable {
+ public:
+  // returns the numbers of the supported queries
+  static const std::vector<size_t>& query_ids();
+
+  // returns the root operator of the plan of the given query, which has not been executed yet
+  static std::shared_ptr<AbstractOperator> build_plan(const size_t query_id, const bool runtime_filters = true);
+};
+
+}  // namespace opossum
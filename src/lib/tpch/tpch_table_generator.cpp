@@ -0,0 +1,494 @@
+#include "tpch_table_generator.hpp"
+
+#include <boost/hana/for_each.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// splitmix64, which produces the same numbers on every platform, unlike the distributions of <random>
+class TpchRandom {
+ public:
+  explicit TpchRandom(const uint64_t seed) : _state(seed) {}
+
+  uint64_t next() {
+    auto value = (_state += 0x9E3779B97F4A7C15);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+    return value ^ (value >> 31);
+  }
+
+  // returns a value in [min, max]
+  int32_t range(const int32_t min, const int32_t max) {
+    return min + static_cast<int32_t>(next() % static_cast<uint64_t>(int64_t{max} - min + 1));
+  }
+
+  template <typename Container>
+  const auto& pick(const Container& container) {
+    return container[next() % container.size()];
+  }
+
+ protected:
+  uint64_t _state;
+};
+
+// every table has its own sequence of random numbers, so that they can be generated independently
+enum TableSeed : uint64_t {
+  RegionSeed = 1,
+  NationSeed,
+  SupplierSeed,
+  CustomerSeed,
+  PartSeed,
+  PartsuppSeed,
+  OrdersSeed
+};
+
+// The values of a column while a table is generated
+template <typename T>
+struct GeneratedColumn {
+  explicit GeneratedColumn(std::string init_name) : name(std::move(init_name)) {}
+
+  std::string name;
+  std::vector<T> values;
+};
+
+template <typename T>
+std::string data_type_name() {
+  auto name = std::string{};
+  hana::for_each(data_types, [&](auto data_type_pair) {
+    if (hana::second(data_type_pair) == hana::type_c<T>) name = hana::first(data_type_pair);
+  });
+  return name;
+}
+
+// splits the generated columns into chunks of ValueSegments
+template <typename... Types>
+std::shared_ptr<Table> make_table(const uint32_t chunk_size, GeneratedColumn<Types>&... columns) {
+  auto table = std::make_shared<Table>(chunk_size);
+  (table->add_column_definition(columns.name, data_type_name<Types>()), ...);
+
+  const auto row_counts = std::array<size_t, sizeof...(Types)>{columns.values.size()...};
+  DebugAssert(std::all_of(row_counts.cbegin(), row_counts.cend(),
+                          [&](const auto row_count) { return row_count == row_counts.front(); }),
+              "Generated columns differ in length");
+
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_counts.front(); chunk_begin += chunk_size) {
+    const auto chunk_end = std::min(row_counts.front(), chunk_begin + chunk_size);
+    auto chunk = std::make_shared<Chunk>();
+    (chunk->add_segment(std::make_shared<ValueSegment<Types>>(
+         std::vector<Types>(std::make_move_iterator(columns.values.begin() + chunk_begin),
+                            std::make_move_iterator(columns.values.begin() + chunk_end)))),
+     ...);
+    table->emplace_chunk(chunk);
+  }
+  return table;
+}
+
+// Dates are numbered by days since 1992-01-01, the first order date. The conversions are the days_from_civil and
+// civil_from_days algorithms of Howard Hinnant (http://howardhinnant.github.io/date_algorithms.html).
+int32_t day_number(int32_t year, const int32_t month, const int32_t day) {
+  year -= month <= 2;
+  const auto era = year / 400;
+  const auto year_of_era = year - era * 400;
+  const auto day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  // 1992-01-01 is day 727'503 since 0000-03-01
+  return era * 146'097 + day_of_era - 727'503;
+}
+
+std::string date_string(const int32_t date) {
+  const auto days = date + 727'503;
+  const auto era = days / 146'097;
+  const auto day_of_era = days - era * 146'097;
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36'524 - day_of_era / 146'096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  const auto year = year_of_era + era * 400 + (month <= 2);
+
+  auto buffer = std::array<char, 16>{};
+  std::snprintf(buffer.data(), buffer.size(), "%04d-%02d-%02d", year, month, day);
+  return buffer.data();
+}
+
+const auto START_DATE = day_number(1992, 1, 1);
+const auto CURRENT_DATE = day_number(1995, 6, 17);
+const auto END_DATE = day_number(1998, 12, 31);
+
+// e.g., "Customer#000000042"
+std::string numbered_name(const std::string& prefix, const int32_t number) {
+  auto buffer = std::array<char, 16>{};
+  std::snprintf(buffer.data(), buffer.size(), "%09d", number);
+  return prefix + "#" + buffer.data();
+}
+
+// a phone number whose country code is derived from the nation, e.g., "25-989-741-2988"
+std::string phone_number(TpchRandom& random, const int32_t nation_key) {
+  auto buffer = std::array<char, 32>{};
+  std::snprintf(buffer.data(), buffer.size(), "%02d-%03d-%03d-%04d", nation_key + 10, random.range(100, 999),
+                random.range(100, 999), random.range(1000, 9999));
+  return buffer.data();
+}
+
+// a random amount with two decimal places in [min_cents, max_cents] / 100
+double random_amount(TpchRandom& random, const int32_t min_cents, const int32_t max_cents) {
+  return random.range(min_cents, max_cents) / 100.0;
+}
+
+// random alphanumeric characters, like the addresses of the specification
+std::string random_string(TpchRandom& random, const int32_t min_length, const int32_t max_length) {
+  static const auto characters = std::string{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,"};
+  auto string = std::string(random.range(min_length, max_length), ' ');
+  for (auto& character : string) character = random.pick(characters);
+  return string;
+}
+
+// random words, as a simplification of the text grammar of the specification
+std::string random_text(TpchRandom& random, const int32_t min_length, const int32_t max_length) {
+  static const auto words = std::vector<std::string>{
+      "furiously", "quickly", "carefully", "blithely", "slyly", "fluffily", "final", "regular", "express", "pending",
+      "ironic", "even", "bold", "silent", "special", "unusual", "packages", "requests", "accounts", "deposits", "foxes",
+      "ideas", "theodolites", "pinto beans", "instructions", "platelets", "sleep", "wake", "are", "cajole", "haggle",
+      "nag", "use", "boost", "detect", "integrate", "among", "across", "above", "against", "along", "beyond", "about",
+      "after"};
+
+  const auto length = static_cast<size_t>(random.range(min_length, max_length));
+  auto text = random.pick(words);
+  while (text.size() < length) text += " " + random.pick(words);
+  text.resize(length);
+  return text;
+}
+
+// P_RETAILPRICE of the specification, which L_EXTENDEDPRICE is derived from
+double retail_price(const int32_t part_key) {
+  return (90'000 + ((part_key / 10) % 20'001) + 100 * (part_key % 1'000)) / 100.0;
+}
+
+// the key of the i-th (0 to 3) supplier of a part, see PS_SUPPKEY of the specification
+int32_t part_supplier_key(const int32_t part_key, const int32_t i, const int32_t supplier_count) {
+  const auto key = int64_t{part_key} + i * (supplier_count / 4 + (int64_t{part_key} - 1) / supplier_count);
+  return static_cast<int32_t>(key % supplier_count + 1);
+}
+
+const auto REGION_NAMES = std::vector<std::string>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+// the names of the nations and the keys of their regions
+const auto NATIONS = std::vector<std::pair<std::string, int32_t>>{
+    {"ALGERIA", 0}, {"ARGENTINA", 1}, {"BRAZIL", 1}, {"CANADA", 1}, {"EGYPT", 4}, {"ETHIOPIA", 0}, {"FRANCE", 3},
+    {"GERMANY", 3}, {"INDIA", 2}, {"INDONESIA", 2}, {"IRAN", 4}, {"IRAQ", 4}, {"JAPAN", 2}, {"JORDAN", 4},
+    {"KENYA", 0}, {"MOROCCO", 0}, {"MOZAMBIQUE", 0}, {"PERU", 1}, {"CHINA", 2}, {"ROMANIA", 3}, {"SAUDI ARABIA", 4},
+    {"VIETNAM", 2}, {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}};
+
+const auto PART_NAME_WORDS = std::vector<std::string>{
+    "almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue", "blush", "brown",
+    "burlywood", "burnished", "chartreuse", "chiffon", "chocolate", "coral", "cornflower", "cornsilk", "cream", "cyan",
+    "dark", "deep", "dim", "dodger", "drab", "firebrick", "floral", "forest", "frosted", "gainsboro", "ghost",
+    "goldenrod", "green", "grey", "honeydew", "hot", "indian", "ivory", "khaki", "lace", "lavender", "lawn", "lemon",
+    "light", "lime", "linen", "magenta", "maroon", "medium", "metallic", "midnight", "mint", "misty", "moccasin",
+    "navajo", "navy", "olive", "orange", "orchid", "pale", "papaya", "peach", "peru", "pink", "plum", "powder", "puff",
+    "purple", "red", "rose", "rosy", "royal", "saddle", "salmon", "sandy", "seashell", "sienna", "sky", "slate",
+    "smoke", "snow", "spring", "steel", "tan", "thistle", "tomato", "turquoise", "violet", "wheat", "white", "yellow"};
+
+const auto PART_TYPE_SIZES = std::vector<std::string>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto PART_TYPE_FINISHES = std::vector<std::string>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto PART_TYPE_MATERIALS = std::vector<std::string>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto CONTAINER_SIZES = std::vector<std::string>{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto CONTAINER_TYPES = std::vector<std::string>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+const auto MARKET_SEGMENTS = std::vector<std::string>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto ORDER_PRIORITIES = std::vector<std::string>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto SHIP_INSTRUCTIONS = std::vector<std::string>{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const auto SHIP_MODES = std::vector<std::string>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+}  // namespace
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const uint32_t chunk_size)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size) {
+  Assert(scale_factor > 0.0f, "The scale factor must be positive");
+  Assert(chunk_size > 0, "The chunk size must be positive");
+}
+
+float TpchTableGenerator::scale_factor() const { return _scale_factor; }
+
+uint32_t TpchTableGenerator::chunk_size() const { return _chunk_size; }
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate() const {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  tables["region"] = generate_region();
+  tables["nation"] = generate_nation();
+  tables["supplier"] = generate_supplier();
+  tables["customer"] = generate_customer();
+  tables["part"] = generate_part();
+  tables["partsupp"] = generate_partsupp();
+  std::tie(tables["orders"], tables["lineitem"]) = generate_orders_and_lineitem();
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  for (auto& [name, table] : generate()) StorageManager::get().add_table(name, table);
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_region() const {
+  auto random = TpchRandom{RegionSeed};
+  auto r_regionkey = GeneratedColumn<int32_t>{"r_regionkey"};
+  auto r_name = GeneratedColumn<std::string>{"r_name"};
+  auto r_comment = GeneratedColumn<std::string>{"r_comment"};
+
+  for (auto region_key = int32_t{0}; region_key < static_cast<int32_t>(REGION_NAMES.size()); ++region_key) {
+    r_regionkey.values.emplace_back(region_key);
+    r_name.values.emplace_back(REGION_NAMES[region_key]);
+    r_comment.values.emplace_back(random_text(random, 31, 115));
+  }
+  return make_table(_chunk_size, r_regionkey, r_name, r_comment);
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_nation() const {
+  auto random = TpchRandom{NationSeed};
+  auto n_nationkey = GeneratedColumn<int32_t>{"n_nationkey"};
+  auto n_name = GeneratedColumn<std::string>{"n_name"};
+  auto n_regionkey = GeneratedColumn<int32_t>{"n_regionkey"};
+  auto n_comment = GeneratedColumn<std::string>{"n_comment"};
+
+  for (auto nation_key = int32_t{0}; nation_key < static_cast<int32_t>(NATIONS.size()); ++nation_key) {
+    n_nationkey.values.emplace_back(nation_key);
+    n_name.values.emplace_back(NATIONS[nation_key].first);
+    n_regionkey.values.emplace_back(NATIONS[nation_key].second);
+    n_comment.values.emplace_back(random_text(random, 31, 114));
+  }
+  return make_table(_chunk_size, n_nationkey, n_name, n_regionkey, n_comment);
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_supplier() const {
+  auto random = TpchRandom{SupplierSeed};
+  auto s_suppkey = GeneratedColumn<int32_t>{"s_suppkey"};
+  auto s_name = GeneratedColumn<std::string>{"s_name"};
+  auto s_address = GeneratedColumn<std::string>{"s_address"};
+  auto s_nationkey = GeneratedColumn<int32_t>{"s_nationkey"};
+  auto s_phone = GeneratedColumn<std::string>{"s_phone"};
+  auto s_acctbal = GeneratedColumn<double>{"s_acctbal"};
+  auto s_comment = GeneratedColumn<std::string>{"s_comment"};
+
+  const auto supplier_count = static_cast<int32_t>(_row_count(10'000));
+  for (auto supplier_key = int32_t{1}; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_key = random.range(0, 24);
+    s_suppkey.values.emplace_back(supplier_key);
+    s_name.values.emplace_back(numbered_name("Supplier", supplier_key));
+    s_address.values.emplace_back(random_string(random, 10, 40));
+    s_nationkey.values.emplace_back(nation_key);
+    s_phone.values.emplace_back(phone_number(random, nation_key));
+    s_acctbal.values.emplace_back(random_amount(random, -99'999, 999'999));
+    s_comment.values.emplace_back(random_text(random, 25, 100));
+  }
+  return make_table(_chunk_size, s_suppkey, s_name, s_address, s_nationkey, s_phone, s_acctbal, s_comment);
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_customer() const {
+  auto random = TpchRandom{CustomerSeed};
+  auto c_custkey = GeneratedColumn<int32_t>{"c_custkey"};
+  auto c_name = GeneratedColumn<std::string>{"c_name"};
+  auto c_address = GeneratedColumn<std::string>{"c_address"};
+  auto c_nationkey = GeneratedColumn<int32_t>{"c_nationkey"};
+  auto c_phone = GeneratedColumn<std::string>{"c_phone"};
+  auto c_acctbal = GeneratedColumn<double>{"c_acctbal"};
+  auto c_mktsegment = GeneratedColumn<std::string>{"c_mktsegment"};
+  auto c_comment = GeneratedColumn<std::string>{"c_comment"};
+
+  const auto customer_count = static_cast<int32_t>(_row_count(150'000));
+  for (auto customer_key = int32_t{1}; customer_key <= customer_count; ++customer_key) {
+    const auto nation_key = random.range(0, 24);
+    c_custkey.values.emplace_back(customer_key);
+    c_name.values.emplace_back(numbered_name("Customer", customer_key));
+    c_address.values.emplace_back(random_string(random, 10, 40));
+    c_nationkey.values.emplace_back(nation_key);
+    c_phone.values.emplace_back(phone_number(random, nation_key));
+    c_acctbal.values.emplace_back(random_amount(random, -99'999, 999'999));
+    c_mktsegment.values.emplace_back(random.pick(MARKET_SEGMENTS));
+    c_comment.values.emplace_back(random_text(random, 29, 116));
+  }
+  return make_table(_chunk_size, c_custkey, c_name, c_address, c_nationkey, c_phone, c_acctbal, c_mktsegment,
+                    c_comment);
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_part() const {
+  auto random = TpchRandom{PartSeed};
+  auto p_partkey = GeneratedColumn<int32_t>{"p_partkey"};
+  auto p_name = GeneratedColumn<std::string>{"p_name"};
+  auto p_mfgr = GeneratedColumn<std::string>{"p_mfgr"};
+  auto p_brand = GeneratedColumn<std::string>{"p_brand"};
+  auto p_type = GeneratedColumn<std::string>{"p_type"};
+  auto p_size = GeneratedColumn<int32_t>{"p_size"};
+  auto p_container = GeneratedColumn<std::string>{"p_container"};
+  auto p_retailprice = GeneratedColumn<double>{"p_retailprice"};
+  auto p_comment = GeneratedColumn<std::string>{"p_comment"};
+
+  const auto part_count = static_cast<int32_t>(_row_count(200'000));
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    // five distinct words
+    auto name_words = std::vector<std::string>{};
+    while (name_words.size() < 5) {
+      const auto& word = random.pick(PART_NAME_WORDS);
+      if (std::find(name_words.cbegin(), name_words.cend(), word) == name_words.cend()) name_words.emplace_back(word);
+    }
+    auto name = name_words.front();
+    for (auto word = std::next(name_words.cbegin()); word != name_words.cend(); ++word) name += " " + *word;
+
+    const auto manufacturer = random.range(1, 5);
+    p_partkey.values.emplace_back(part_key);
+    p_name.values.emplace_back(std::move(name));
+    p_mfgr.values.emplace_back("Manufacturer#" + std::to_string(manufacturer));
+    p_brand.values.emplace_back("Brand#" + std::to_string(manufacturer) + std::to_string(random.range(1, 5)));
+    p_type.values.emplace_back(random.pick(PART_TYPE_SIZES) + " " + random.pick(PART_TYPE_FINISHES) + " " +
+                               random.pick(PART_TYPE_MATERIALS));
+    p_size.values.emplace_back(random.range(1, 50));
+    p_container.values.emplace_back(random.pick(CONTAINER_SIZES) + " " + random.pick(CONTAINER_TYPES));
+    p_retailprice.values.emplace_back(retail_price(part_key));
+    p_comment.values.emplace_back(random_text(random, 5, 22));
+  }
+  return make_table(_chunk_size, p_partkey, p_name, p_mfgr, p_brand, p_type, p_size, p_container, p_retailprice,
+                    p_comment);
+}
+
+std::shared_ptr<Table> TpchTableGenerator::generate_partsupp() const {
+  auto random = TpchRandom{PartsuppSeed};
+  auto ps_partkey = GeneratedColumn<int32_t>{"ps_partkey"};
+  auto ps_suppkey = GeneratedColumn<int32_t>{"ps_suppkey"};
+  auto ps_availqty = GeneratedColumn<int32_t>{"ps_availqty"};
+  auto ps_supplycost = GeneratedColumn<double>{"ps_supplycost"};
+  auto ps_comment = GeneratedColumn<std::string>{"ps_comment"};
+
+  const auto part_count = static_cast<int32_t>(_row_count(200'000));
+  const auto supplier_count = static_cast<int32_t>(_row_count(10'000));
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    for (auto i = int32_t{0}; i < 4; ++i) {
+      ps_partkey.values.emplace_back(part_key);
+      ps_suppkey.values.emplace_back(part_supplier_key(part_key, i, supplier_count));
+      ps_availqty.values.emplace_back(random.range(1, 9'999));
+      ps_supplycost.values.emplace_back(random_amount(random, 100, 100'000));
+      ps_comment.values.emplace_back(random_text(random, 49, 198));
+    }
+  }
+  return make_table(_chunk_size, ps_partkey, ps_suppkey, ps_availqty, ps_supplycost, ps_comment);
+}
+
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> TpchTableGenerator::generate_orders_and_lineitem() const {
+  auto random = TpchRandom{OrdersSeed};
+  auto o_orderkey = GeneratedColumn<int32_t>{"o_orderkey"};
+  auto o_custkey = GeneratedColumn<int32_t>{"o_custkey"};
+  auto o_orderstatus = GeneratedColumn<std::string>{"o_orderstatus"};
+  auto o_totalprice = GeneratedColumn<double>{"o_totalprice"};
+  auto o_orderdate = GeneratedColumn<std::string>{"o_orderdate"};
+  auto o_orderpriority = GeneratedColumn<std::string>{"o_orderpriority"};
+  auto o_clerk = GeneratedColumn<std::string>{"o_clerk"};
+  auto o_shippriority = GeneratedColumn<int32_t>{"o_shippriority"};
+  auto o_comment = GeneratedColumn<std::string>{"o_comment"};
+
+  auto l_orderkey = GeneratedColumn<int32_t>{"l_orderkey"};
+  auto l_partkey = GeneratedColumn<int32_t>{"l_partkey"};
+  auto l_suppkey = GeneratedColumn<int32_t>{"l_suppkey"};
+  auto l_linenumber = GeneratedColumn<int32_t>{"l_linenumber"};
+  auto l_quantity = GeneratedColumn<double>{"l_quantity"};
+  auto l_extendedprice = GeneratedColumn<double>{"l_extendedprice"};
+  auto l_discount = GeneratedColumn<double>{"l_discount"};
+  auto l_tax = GeneratedColumn<double>{"l_tax"};
+  auto l_returnflag = GeneratedColumn<std::string>{"l_returnflag"};
+  auto l_linestatus = GeneratedColumn<std::string>{"l_linestatus"};
+  auto l_shipdate = GeneratedColumn<std::string>{"l_shipdate"};
+  auto l_commitdate = GeneratedColumn<std::string>{"l_commitdate"};
+  auto l_receiptdate = GeneratedColumn<std::string>{"l_receiptdate"};
+  auto l_shipinstruct = GeneratedColumn<std::string>{"l_shipinstruct"};
+  auto l_shipmode = GeneratedColumn<std::string>{"l_shipmode"};
+  auto l_comment = GeneratedColumn<std::string>{"l_comment"};
+
+  // all dates lie between the first order date and the last receipt date, i.e., END_DATE
+  auto date_strings = std::vector<std::string>{};
+  for (auto date = START_DATE; date <= END_DATE; ++date) date_strings.emplace_back(date_string(date));
+
+  const auto order_count = static_cast<int32_t>(_row_count(1'500'000));
+  const auto customer_count = static_cast<int32_t>(_row_count(150'000));
+  const auto part_count = static_cast<int32_t>(_row_count(200'000));
+  const auto supplier_count = static_cast<int32_t>(_row_count(10'000));
+  const auto clerk_count = static_cast<int32_t>(_row_count(1'000));
+
+  for (auto order_key = int32_t{1}; order_key <= order_count; ++order_key) {
+    // a third of the customers does not have any orders
+    auto customer_key = random.range(1, customer_count);
+    while (customer_key % 3 == 0) customer_key = random.range(1, customer_count);
+    const auto order_date = random.range(START_DATE, END_DATE - 151);
+
+    auto total_price = 0.0;
+    auto shipped_line_count = 0;
+    const auto line_count = random.range(1, 7);
+    for (auto line_number = int32_t{1}; line_number <= line_count; ++line_number) {
+      const auto part_key = random.range(1, part_count);
+      const auto quantity = random.range(1, 50);
+      const auto extended_price = quantity * retail_price(part_key);
+      const auto discount = random_amount(random, 0, 10);
+      const auto tax = random_amount(random, 0, 8);
+      const auto ship_date = order_date + random.range(1, 121);
+      const auto commit_date = order_date + random.range(30, 90);
+      const auto receipt_date = ship_date + random.range(1, 30);
+
+      l_orderkey.values.emplace_back(order_key);
+      l_partkey.values.emplace_back(part_key);
+      l_suppkey.values.emplace_back(part_supplier_key(part_key, random.range(0, 3), supplier_count));
+      l_linenumber.values.emplace_back(line_number);
+      l_quantity.values.emplace_back(quantity);
+      l_extendedprice.values.emplace_back(extended_price);
+      l_discount.values.emplace_back(discount);
+      l_tax.values.emplace_back(tax);
+      l_returnflag.values.emplace_back(receipt_date <= CURRENT_DATE ? (random.range(0, 1) ? "R" : "A") : "N");
+      l_linestatus.values.emplace_back(ship_date > CURRENT_DATE ? "O" : "F");
+      l_shipdate.values.emplace_back(date_strings[ship_date]);
+      l_commitdate.values.emplace_back(date_strings[commit_date]);
+      l_receiptdate.values.emplace_back(date_strings[receipt_date]);
+      l_shipinstruct.values.emplace_back(random.pick(SHIP_INSTRUCTIONS));
+      l_shipmode.values.emplace_back(random.pick(SHIP_MODES));
+      l_comment.values.emplace_back(random_text(random, 10, 43));
+
+      total_price += extended_price * (1.0 + tax) * (1.0 - discount);
+      shipped_line_count += ship_date <= CURRENT_DATE;
+    }
+
+    o_orderkey.values.emplace_back(order_key);
+    o_custkey.values.emplace_back(customer_key);
+    o_orderstatus.values.emplace_back(shipped_line_count == line_count ? "F" : shipped_line_count == 0 ? "O" : "P");
+    o_totalprice.values.emplace_back(std::round(total_price * 100.0) / 100.0);
+    o_orderdate.values.emplace_back(date_strings[order_date]);
+    o_orderpriority.values.emplace_back(random.pick(ORDER_PRIORITIES));
+    o_clerk.values.emplace_back(numbered_name("Clerk", random.range(1, clerk_count)));
+    o_shippriority.values.emplace_back(0);
+    o_comment.values.emplace_back(random_text(random, 19, 78));
+  }
+
+  auto orders = make_table(_chunk_size, o_orderkey, o_custkey, o_orderstatus, o_totalprice, o_orderdate,
+                           o_orderpriority, o_clerk, o_shippriority, o_comment);
+  auto lineitem = make_table(_chunk_size, l_orderkey, l_partkey, l_suppkey, l_linenumber, l_quantity,
+                             l_extendedprice, l_discount, l_tax, l_returnflag, l_linestatus, l_shipdate, l_commitdate,
+                             l_receiptdate, l_shipinstruct, l_shipmode, l_comment);
+  return {orders, lineitem};
+}
+
+size_t TpchTableGenerator::_row_count(const size_t base_row_count) const {
+  return std::max(size_t{1}, static_cast<size_t>(std::llround(double{_scale_factor} * base_row_count)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Generates the eight tables of the TPC-H benchmark (region, nation, supplier, customer, part, partsupp, orders, and
+// lineitem) directly into Tables of ValueSegments, so that no dbgen or data files are needed. The row counts and the
+// value distributions follow the TPC-H specification (section 4.2.3) where the queries depend on them, e.g., the
+// dates of orders and lineitems, the retail prices, or the relation of ps_suppkey and l_suppkey to the part keys.
+// Other values are simplified: comments are random words, and orders are numbered densely. Thus, query results do not
+// match the official answer sets, but the data is the same for the same scale factor on every platform, as it only
+// depends on our own pseudo random number generator. Dates are stored as "YYYY-MM-DD" strings, prices as doubles.
+class TpchTableGenerator {
+ public:
+  // scale factor 1 results in about 1 GB of data (6 million lineitems)
+  TpchTableGenerator(const float scale_factor, const uint32_t chunk_size);
+
+  float scale_factor() const;
+  uint32_t chunk_size() const;
+
+  // returns the tables by their name, e.g., "lineitem"
+  std::map<std::string, std::shared_ptr<Table>> generate() const;
+
+  // adds the generated tables to the StorageManager
+  void generate_and_store() const;
+
+  std::shared_ptr<Table> generate_region() const;
+  std::shared_ptr<Table> generate_nation() const;
+  std::shared_ptr<Table> generate_supplier() const;
+  std::shared_ptr<Table> generate_customer() const;
+  std::shared_ptr<Table> generate_part() const;
+  std::shared_ptr<Table> generate_partsupp() const;
+
+  // lineitems are generated together with their orders, returns {orders, lineitem}
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> generate_orders_and_lineitem() const;
+
+ protected:
+  // returns the number of rows for a table that has base_row_count rows at scale factor 1 (at least one)
+  size_t _row_count(const size_t base_row_count) const;
+
+  const float _scale_factor;
+  const uint32_t _chunk_size;
+};
+
+}  // namespace opossum
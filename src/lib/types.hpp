@@ -53,7 +53,21 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// A list of positions, e.g., the matches of a table scan. If all positions point into the same chunk, the producer
+// can guarantee this so that consumers can resolve the referenced chunk once instead of once per position.
+class PosList : public std::vector<RowID> {
+ public:
+  using std::vector<RowID>::vector;
+
+  // marks that all positions reference the same chunk
+  void guarantee_single_chunk() { _references_single_chunk = true; }
+
+  // returns whether all positions are guaranteed to reference the same chunk
+  bool references_single_chunk() const { return _references_single_chunk; }
+
+ protected:
+  bool _references_single_chunk = false;
+};
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
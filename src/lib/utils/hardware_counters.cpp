@@ -0,0 +1,163 @@
+#include "hardware_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+// The perf events of a thread, opened as one group. The leader is the first counter that could be opened, usually the
+// cycles, and the group is read at once.
+struct ThreadCounters {
+  ThreadCounters() {
+#ifdef __linux__
+    const uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+                                PERF_COUNT_HW_BRANCH_MISSES};
+    for (auto counter = size_t{0}; counter < file_descriptors.size(); ++counter) {
+      auto attributes = perf_event_attr{};
+      attributes.size = sizeof(perf_event_attr);
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = configs[counter];
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      // the calling thread on any CPU, in the group of the leader unless this is the leader
+      const auto group_file_descriptor = members.empty() ? -1 : file_descriptors[members.front()];
+      file_descriptors[counter] =
+          static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, group_file_descriptor, 0));
+      if (file_descriptors[counter] < 0) continue;
+
+      members.emplace_back(counter);
+      available_counters |= 1u << counter;
+    }
+#endif
+  }
+
+  ~ThreadCounters() {
+#ifdef __linux__
+    // the leader is closed last
+    for (auto member = members.rbegin(); member != members.rend(); ++member) close(file_descriptors[*member]);
+#endif
+  }
+
+  HardwareCounterReadings read() const {
+    auto readings = HardwareCounterReadings{};
+    readings.available_counters = available_counters;
+#ifdef __linux__
+    if (members.empty()) return readings;
+
+    // the number of events, the times the group was enabled and running, and the values in the order of members
+    auto values = std::array<uint64_t, 3 + 4>{};
+    const auto size = sizeof(uint64_t) * (3 + members.size());
+    if (::read(file_descriptors[members.front()], values.data(), size) != static_cast<ssize_t>(size)) return readings;
+
+    const auto time_enabled = values[1];
+    const auto time_running = values[2];
+    if (time_running == 0) return readings;
+    for (auto member_index = size_t{0}; member_index < members.size(); ++member_index) {
+      const auto value = values[3 + member_index];
+      readings.counts[members[member_index]] = time_running == time_enabled
+                                                   ? value
+                                                   : static_cast<uint64_t>(static_cast<double>(value) *
+                                                                           static_cast<double>(time_enabled) /
+                                                                           static_cast<double>(time_running));
+    }
+#endif
+    return readings;
+  }
+
+  std::array<int, 4> file_descriptors{-1, -1, -1, -1};
+
+  // the counters that could be opened, the leader of the group first
+  std::vector<size_t> members;
+  uint8_t available_counters = 0;
+};
+
+ThreadCounters& thread_counters() {
+  thread_local auto counters = ThreadCounters{};
+  return counters;
+}
+
+void print_per_row(std::ostream& stream, const char* name, const std::optional<uint64_t>& count,
+                   const uint64_t row_count) {
+  if (!count) return;
+  stream << ", ";
+  if (row_count > 0) {
+    stream << std::fixed << std::setprecision(3) << static_cast<double>(*count) / static_cast<double>(row_count) << " "
+           << name << "/row";
+  } else {
+    stream << *count << " " << name;
+  }
+}
+
+}  // namespace
+
+HardwareCounterValues HardwareCounterValues::from_readings(const HardwareCounterReadings& readings) {
+  const auto value = [&](const HardwareCounters::Counter counter) -> std::optional<uint64_t> {
+    if (!(readings.available_counters & (1u << counter))) return std::nullopt;
+    return readings.counts[counter];
+  };
+  return HardwareCounterValues{value(HardwareCounters::Cycles), value(HardwareCounters::Instructions),
+                               value(HardwareCounters::LastLevelCacheMisses), value(HardwareCounters::BranchMisses)};
+}
+
+HardwareCounterValues& HardwareCounterValues::operator+=(const HardwareCounterValues& other) {
+  const auto add = [](std::optional<uint64_t>& value, const std::optional<uint64_t>& other_value) {
+    value = value && other_value ? std::optional<uint64_t>{*value + *other_value} : std::nullopt;
+  };
+  add(cycles, other.cycles);
+  add(instructions, other.instructions);
+  add(last_level_cache_misses, other.last_level_cache_misses);
+  add(branch_misses, other.branch_misses);
+  return *this;
+}
+
+std::optional<double> HardwareCounterValues::instructions_per_cycle() const {
+  if (!cycles || !instructions || *cycles == 0) return std::nullopt;
+  return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+}
+
+std::string HardwareCounterValues::to_string(const uint64_t row_count) const {
+  auto stream = std::stringstream{};
+  if (const auto ipc = instructions_per_cycle()) {
+    stream << ", IPC " << std::fixed << std::setprecision(2) << *ipc;
+  } else if (cycles) {
+    stream << ", " << *cycles << " cycles";
+  }
+  print_per_row(stream, "LLC misses", last_level_cache_misses, row_count);
+  print_per_row(stream, "branch misses", branch_misses, row_count);
+
+  // without the leading separator
+  const auto string = stream.str();
+  return string.empty() ? string : string.substr(2);
+}
+
+std::atomic<bool> HardwareCounters::_enabled{false};
+std::atomic<uint8_t> HardwareCounters::_available_counters{0};
+
+bool HardwareCounters::enable() {
+  const auto available_counters = thread_counters().available_counters;
+  _available_counters = available_counters;
+  _enabled = available_counters != 0;
+  return _enabled;
+}
+
+void HardwareCounters::disable() { _enabled = false; }
+
+bool HardwareCounters::is_available(const Counter counter) { return _available_counters & (1u << counter); }
+
+HardwareCounterReadings HardwareCounters::read_thread_counters() { return thread_counters().read(); }
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// readings of the hardware counters of a thread
+struct HardwareCounterReadings {
+  // in the order of HardwareCounters::Counter, estimated for the entire time the counters were open (see
+  // HardwareCounters), 0 for counters that could not be opened
+  std::array<uint64_t, 4> counts{};
+
+  // bitmask of the counters that could be opened for the thread, by HardwareCounters::Counter
+  uint8_t available_counters = 0;
+};
+
+// Hardware counter values, e.g., of an operator. A counter is missing if it is not available on the system.
+struct HardwareCounterValues {
+  std::optional<uint64_t> cycles;
+  std::optional<uint64_t> instructions;
+  std::optional<uint64_t> last_level_cache_misses;
+  std::optional<uint64_t> branch_misses;
+
+  // returns the values of the counters that are available in the readings
+  static HardwareCounterValues from_readings(const HardwareCounterReadings& readings);
+
+  // Adds the values of other, e.g., of another operator. A counter that is missing in either is missing afterwards.
+  HardwareCounterValues& operator+=(const HardwareCounterValues& other);
+
+  // instructions per cycle, if both counters are available and cycles were counted
+  std::optional<double> instructions_per_cycle() const;
+
+  // returns a summary relative to the given number of rows, e.g., "IPC 1.23, 0.45 LLC misses/row, ...", or "" if no
+  // counter is available
+  std::string to_string(const uint64_t row_count) const;
+};
+
+// HardwareCounters reads the cycles, instructions, last level cache misses, and branch misses of threads with the
+// perf_event_open system call of Linux. They are disabled by default. Once enabled, CpuTimeAccounts collect them
+// along with the CPU time, so that they are part of the PerformanceData of operators.
+//
+// The counters of a thread are opened as one group with the cycles as the leader, so that the kernel schedules them
+// together. If there are more events than hardware counters, e.g., because other processes use some, the kernel
+// multiplexes the groups. The counts are then scaled by the ratio of the time the group was enabled to the time it was
+// running, and all counters of a thread are estimated from the same time windows, so ratios such as the IPC hold.
+//
+// Depending on the system, e.g., in virtual machines, containers, or with a restrictive
+// /proc/sys/kernel/perf_event_paranoid, some or all counters cannot be opened. These are reported as missing, and
+// enable returns false if none is available. As this is checked for every thread, the counters of an operator are
+// only reported if they were available on all threads that worked for it. Only user space events are counted.
+class HardwareCounters : private Noncopyable {
+ public:
+  enum Counter { Cycles, Instructions, LastLevelCacheMisses, BranchMisses };
+
+  // Opens the counters for the calling thread to find out which ones are available. Returns whether any is, and
+  // enables the counters if so.
+  static bool enable();
+  static void disable();
+  static bool is_enabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  // returns whether the given counter could be opened for the thread that enabled the counters
+  static bool is_available(const Counter counter);
+
+  // Returns the counts of the calling thread since it first read them. The counters are opened by the first call of
+  // each thread and closed when it exits.
+  static HardwareCounterReadings read_thread_counters();
+
+ protected:
+  static std::atomic<bool> _enabled;
+  // bitmask of the counters available to the thread that enabled them
+  static std::atomic<uint8_t> _available_counters;
+};
+
+}  // namespace opossum
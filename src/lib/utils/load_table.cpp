@@ -6,10 +6,12 @@
 #include <vector>
 
 #include "storage/table.hpp"
+#include "utils/tracer.hpp"
 
 namespace opossum {
 
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
+  const auto trace_scope = Tracer::Scope{"storage", "load_table"};
   std::ifstream infile(file_name);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
 
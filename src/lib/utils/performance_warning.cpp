@@ -0,0 +1,164 @@
+#include "performance_warning.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the counters of a thread, which only the thread itself increments
+struct ThreadCounters {
+  std::array<std::atomic<uint64_t>, PerformanceWarnings::MAX_WARNING_COUNT> counts{};
+};
+
+struct Registry {
+  std::mutex mutex;
+  // the names of the warnings by their id
+  std::vector<std::string> names;
+  std::vector<std::shared_ptr<ThreadCounters>> thread_counters;
+  // the counts of threads that have exited
+  std::array<uint64_t, PerformanceWarnings::MAX_WARNING_COUNT> finished_thread_counts{};
+};
+
+// never destroyed, as threads may exit after static objects are destroyed
+Registry& registry() {
+  static auto registry = new Registry{};
+  return *registry;
+}
+
+// registers the counters of a thread on its first hit and merges them into the registry when the thread exits
+struct ThreadCountersHandle {
+  ~ThreadCountersHandle() {
+    if (!counters) return;
+    auto& global_registry = registry();
+    auto lock = std::lock_guard(global_registry.mutex);
+    for (auto warning_id = size_t{0}; warning_id < PerformanceWarnings::MAX_WARNING_COUNT; ++warning_id) {
+      global_registry.finished_thread_counts[warning_id] += counters->counts[warning_id].load();
+    }
+    auto& thread_counters = global_registry.thread_counters;
+    thread_counters.erase(std::find(thread_counters.begin(), thread_counters.end(), counters));
+  }
+
+  ThreadCounters& get() {
+    if (!counters) {
+      counters = std::make_shared<ThreadCounters>();
+      auto& global_registry = registry();
+      auto lock = std::lock_guard(global_registry.mutex);
+      global_registry.thread_counters.emplace_back(counters);
+    }
+    return *counters;
+  }
+
+  std::shared_ptr<ThreadCounters> counters;
+};
+
+thread_local auto thread_counters_handle = ThreadCountersHandle{};
+
+// returns the counts of all warnings by their id, the registry needs to be locked
+std::array<uint64_t, PerformanceWarnings::MAX_WARNING_COUNT> summed_counts(const Registry& global_registry) {
+  auto counts = global_registry.finished_thread_counts;
+  for (const auto& thread_counters : global_registry.thread_counters) {
+    for (auto warning_id = size_t{0}; warning_id < global_registry.names.size(); ++warning_id) {
+      counts[warning_id] += thread_counters->counts[warning_id].load(std::memory_order_relaxed);
+    }
+  }
+  return counts;
+}
+
+}  // namespace
+
+thread_local bool PerformanceWarnings::_enabled{true};
+std::atomic<bool> PerformanceWarnings::_strict{false};
+
+PerformanceWarnings::Site::Site(const std::string& name, const std::string& location)
+    : _name(name),
+      _location(location),
+      _warning_id([&]() {
+        auto& global_registry = registry();
+        auto lock = std::lock_guard(global_registry.mutex);
+        auto& names = global_registry.names;
+        const auto iterator = std::find(names.cbegin(), names.cend(), name);
+        if (iterator != names.cend()) return static_cast<size_t>(std::distance(names.cbegin(), iterator));
+
+        Assert(names.size() < MAX_WARNING_COUNT, "Too many distinct performance warnings");
+        names.emplace_back(name);
+        return names.size() - 1;
+      }()) {}
+
+void PerformanceWarnings::Site::_hit() {
+  thread_counters_handle.get().counts[_warning_id].fetch_add(1, std::memory_order_relaxed);
+
+#if IS_DEBUG
+  if (!_printed.exchange(true)) {
+    std::cout << "[PERF] " << _name << " at " << _location
+              << "\n\tPerformance can be affected. This warning is only shown once." << std::endl;
+  }
+#endif
+
+  if (is_strict()) Fail("Performance warning " + _name + " at " + _location + " in strict mode");
+}
+
+bool PerformanceWarnings::set_enabled(const bool enabled) {
+  const auto previously_enabled = _enabled;
+  _enabled = enabled;
+  return previously_enabled;
+}
+
+bool PerformanceWarnings::is_strict() { return _strict.load(std::memory_order_relaxed); }
+
+void PerformanceWarnings::set_strict(const bool strict) { _strict = strict; }
+
+uint64_t PerformanceWarnings::count(const std::string& name) {
+  const auto all_counts = counts();
+  const auto iterator = all_counts.find(name);
+  return iterator == all_counts.cend() ? 0 : iterator->second;
+}
+
+PerformanceWarningCounts PerformanceWarnings::counts() {
+  auto& global_registry = registry();
+  auto lock = std::lock_guard(global_registry.mutex);
+  const auto counts_by_id = summed_counts(global_registry);
+
+  auto counts = PerformanceWarningCounts{};
+  for (auto warning_id = size_t{0}; warning_id < global_registry.names.size(); ++warning_id) {
+    if (counts_by_id[warning_id] > 0) counts[global_registry.names[warning_id]] = counts_by_id[warning_id];
+  }
+  return counts;
+}
+
+PerformanceWarningCounts PerformanceWarnings::counts_since(const PerformanceWarningCounts& previous_counts) {
+  auto counts = PerformanceWarnings::counts();
+  for (auto iterator = counts.begin(); iterator != counts.end();) {
+    const auto previous_count = previous_counts.find(iterator->first);
+    if (previous_count != previous_counts.cend()) {
+      iterator->second -= std::min(iterator->second, previous_count->second);
+    }
+    iterator = iterator->second == 0 ? counts.erase(iterator) : std::next(iterator);
+  }
+  return counts;
+}
+
+void PerformanceWarnings::reset() {
+  auto& global_registry = registry();
+  auto lock = std::lock_guard(global_registry.mutex);
+  global_registry.finished_thread_counts.fill(0);
+  for (const auto& thread_counters : global_registry.thread_counters) {
+    for (auto& count : thread_counters->counts) count.store(0, std::memory_order_relaxed);
+  }
+}
+
+void PerformanceWarnings::print(const PerformanceWarningCounts& counts, std::ostream& out) {
+  for (const auto& [name, count] : counts) out << name << ": " << count << "\n";
+}
+
+}  // namespace opossum
@@ -1,16 +1,32 @@
 #pragma once
 
 #include <boost/preprocessor/stringize.hpp>
+
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <map>
 #include <string>
 
+#include "types.hpp"
+
+namespace opossum {
+
+// the number of hits of performance warnings by their name
+using PerformanceWarningCounts = std::map<std::string, uint64_t>;
+
 /**
  * Performance Warnings can be used in places where slow workarounds are used. This includes BaseSegment[] or the
  * use of a cross join followed by a projection instead of an equijoin.
  *
- * The warnings are printed only once per program execution. This is achieved by using static variables.
+ * Every warning has a name, e.g., PerformanceWarning("ValueSegment::operator[]"), and every hit is counted in a
+ * counter of the calling thread, so hits on the hot path only cost a relaxed atomic increment without contention.
+ * The counts of all threads can be queried by name or taken together, e.g., before and after a query to see which
+ * slow paths the query took. The counters are kept in all builds. In debug builds, a warning is also printed on its
+ * first hit. In strict mode, a hit throws, so that a benchmark or test fails when its plans use a slow path.
  *
- * Performance warnings can be disabled using the RAII-style PerformanceWarningDisabler:
+ * Performance warnings can be disabled using the RAII-style PerformanceWarningDisabler, e.g., where a slow path is
+ * used on purpose. Disabled warnings are neither counted nor printed, and do not throw:
  *
  * {
  *   PerformanceWarningDisabler pwd;
@@ -18,55 +34,81 @@
  * }
  * // warnings are enabled again
  *
- * Warnings do not print in tests.
+ * Whether warnings are enabled is a property of the calling thread, so a disabler does not affect queries that other
+ * threads execute concurrently. Note that tasks executed by the WorkerPool run with the state of the worker. The tests
+ * run in strict mode.
  */
+class PerformanceWarnings : private Noncopyable {
+ public:
+  // maximum number of distinct warning names
+  static constexpr auto MAX_WARNING_COUNT = size_t{64};
 
-class PerformanceWarningDisabler;
+  // A place in the code that raises a warning. The PerformanceWarning macro creates one per place, places with the
+  // same name (e.g., instantiations of a template) share a counter.
+  class Site : private Noncopyable {
+   public:
+    Site(const std::string& name, const std::string& location);
 
-class PerformanceWarningClass {
-  static bool& disabled() {
-    // hacky hack that allows us to have state in a header file
-    static bool _disabled{false};
-    return _disabled;
-  }
+    void hit() {
+      if (is_enabled()) _hit();
+    }
 
- public:
-  explicit PerformanceWarningClass(const std::string& text) {
-    if (PerformanceWarningClass::disabled()) return;
-    std::cout << "[PERF] " << text << "\n\tPerformance can be affected. This warning is only shown once." << std::endl;
-  }
+   protected:
+    void _hit();
 
- protected:
-  static bool disable() {
-    bool previous = PerformanceWarningClass::disabled();
-    PerformanceWarningClass::disabled() = true;
-    return previous;
-  }
+    const std::string _name;
+    const std::string _location;
+    const size_t _warning_id;
+    std::atomic<bool> _printed{false};
+  };
 
-  static void enable() { PerformanceWarningClass::disabled() = false; }
+  static bool is_enabled() { return _enabled; }
 
-  friend class PerformanceWarningDisabler;
-};
+  // enables or disables the warnings of the calling thread and returns whether they were enabled before
+  static bool set_enabled(const bool enabled);
+
+  static bool is_strict();
+
+  // in strict mode, hitting an enabled warning throws
+  static void set_strict(const bool strict);
+
+  // returns the number of hits of the warning with the given name, summed over all threads
+  static uint64_t count(const std::string& name);
 
-class PerformanceWarningDisabler {
-  bool _previously_disabled;
+  // returns the counts of all warnings that have been hit, summed over all threads
+  static PerformanceWarningCounts counts();
 
+  // returns the hits since the given counts were taken, e.g., those of a query, without the warnings that were not hit
+  static PerformanceWarningCounts counts_since(const PerformanceWarningCounts& previous_counts);
+
+  // sets all counters to zero
+  static void reset();
+
+  // prints one line per warning, e.g., "ValueSegment::operator[]: 42"
+  static void print(const PerformanceWarningCounts& counts, std::ostream& out = std::cout);
+
+ protected:
+  static thread_local bool _enabled;
+  static std::atomic<bool> _strict;
+};
+
+class PerformanceWarningDisabler : private Noncopyable {
  public:
-  PerformanceWarningDisabler() : _previously_disabled(PerformanceWarningClass::disable()) {}
-  ~PerformanceWarningDisabler() {
-    if (!_previously_disabled) PerformanceWarningClass::enable();
-  }
+  PerformanceWarningDisabler() : _previously_enabled(PerformanceWarnings::set_enabled(false)) {}
+  ~PerformanceWarningDisabler() { PerformanceWarnings::set_enabled(_previously_enabled); }
+
+ protected:
+  const bool _previously_enabled;
 };
 
-#if IS_DEBUG
+}  // namespace opossum
+
 #ifndef __FILENAME__
 #define __FILENAME__ (__FILE__ + SOURCE_PATH_SIZE)
 #endif
-#define PerformanceWarning(text)                                                                 \
-  {                                                                                              \
-    static PerformanceWarningClass warn(std::string(text) + " at " + std::string(__FILENAME__) + \
-                                        ":" BOOST_PP_STRINGIZE(__LINE__));                       \
+#define PerformanceWarning(name)                                               \
+  {                                                                            \
+    static auto performance_warning_site = opossum::PerformanceWarnings::Site( \
+        name, std::string(__FILENAME__) + ":" BOOST_PP_STRINGIZE(__LINE__));   \
+    performance_warning_site.hit();                                            \
   }  // NOLINT
-#else
-#define PerformanceWarning(text)
-#endif
@@ -0,0 +1,63 @@
+#include "plan_printer.hpp"
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+void PlanPrinter::print(const AbstractOperator& root, std::ostream& out) { PlanPrinter{out}._print_tree(root, ""); }
+
+void PlanPrinter::print_dot(const AbstractOperator& root, std::ostream& out) {
+  auto printer = PlanPrinter{out};
+  out << "digraph {\n";
+  out << "  node [shape=box, fontname=\"monospace\"];\n";
+  printer._print_dot_node(root);
+  out << "}\n";
+}
+
+PlanPrinter::PlanPrinter(std::ostream& out) : _out(out) {}
+
+std::pair<size_t, bool> PlanPrinter::_number(const AbstractOperator& op) {
+  const auto [iterator, inserted] = _numbers.emplace(&op, _numbers.size());  // NOLINT
+  return {iterator->second, inserted};
+}
+
+void PlanPrinter::_print_tree(const AbstractOperator& op, const std::string& indentation) {
+  const auto [number, is_new] = _number(op);  // NOLINT
+  if (!is_new) {
+    _out << "[" << number << "] " << op.name() << " (see above)\n";
+    return;
+  }
+  _out << "[" << number << "] " << op.name() << ": " << op.performance_data().to_string() << "\n";
+
+  // the left input is printed first, the vertical line connects it to the right input below
+  const auto left_input = op.input_left();
+  const auto right_input = op.input_right();
+  if (left_input) {
+    _out << indentation << "+- ";
+    _print_tree(*left_input, indentation + (right_input ? "|  " : "   "));
+  }
+  if (right_input) {
+    _out << indentation << "+- ";
+    _print_tree(*right_input, indentation + "   ");
+  }
+}
+
+size_t PlanPrinter::_print_dot_node(const AbstractOperator& op) {
+  const auto [number, is_new] = _number(op);  // NOLINT
+  if (!is_new) return number;
+
+  _out << "  operator" << number << " [label=\"[" << number << "] " << op.name() << "\\n"
+       << op.performance_data().to_string() << "\"];\n";
+  for (const auto& input : {op.input_left(), op.input_right()}) {
+    if (!input) continue;
+    const auto input_number = _print_dot_node(*input);
+    _out << "  operator" << input_number << " -> operator" << number << ";\n";
+  }
+  return number;
+}
+
+}  // namespace opossum
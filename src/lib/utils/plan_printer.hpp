@@ -0,0 +1,43 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Prints an operator and its (transitive) inputs together with their PerformanceData, e.g., after executing a query
+// to see where the time went. Operators that are the input of several others are printed once and referred to by
+// their number afterwards.
+//
+// Example output of print:
+//   [0] Projection: 1.23 ms (cpu 4.56 ms), 120 -> 120 rows, 2 -> 2 chunks, 3.45 KB
+//   +- [1] TableScan: pipelined, 1000 -> 120 rows, 10 -> 2 chunks
+//      +- [2] TableWrapper: 12.3 us (cpu 12.3 us), 0 -> 1000 rows, 0 -> 10 chunks, 45.6 KB
+class PlanPrinter : private Noncopyable {
+ public:
+  // prints the plan as an indented tree
+  static void print(const AbstractOperator& root, std::ostream& out = std::cout);
+
+  // prints the plan as a graph in the DOT language of Graphviz, in which the data flows from the inputs to the root
+  static void print_dot(const AbstractOperator& root, std::ostream& out = std::cout);
+
+ protected:
+  explicit PlanPrinter(std::ostream& out);
+
+  // returns the number of the operator and whether it was assigned by this call, i.e., the operator is new
+  std::pair<size_t, bool> _number(const AbstractOperator& op);
+
+  void _print_tree(const AbstractOperator& op, const std::string& indentation);
+  size_t _print_dot_node(const AbstractOperator& op);
+
+  std::ostream& _out;
+  std::unordered_map<const AbstractOperator*, size_t> _numbers;
+};
+
+}  // namespace opossum
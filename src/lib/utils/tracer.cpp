@@ -0,0 +1,237 @@
+#include "tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+// The members are atomic so that write_chrome_trace can read them while the owning thread overwrites them. Relaxed
+// atomic accesses are as cheap as regular ones.
+struct Event {
+  std::atomic<const char*> category;
+  std::atomic<const char*> name;
+  std::atomic<const char*> argument_name;
+  std::atomic<uint64_t> argument;
+  std::atomic<uint64_t> begin;
+  std::atomic<uint64_t> end;
+};
+
+// A plain copy of an Event
+struct EventCopy {
+  const char* category;
+  const char* name;
+  const char* argument_name;
+  uint64_t argument;
+  uint64_t begin;
+  uint64_t end;
+};
+
+// The ring buffer of a thread. Only the owning thread writes events. Before it overwrites the event with index i
+// (counting all events ever written), it sets started_count to i + 1, afterwards it sets written_count to i + 1.
+// Readers copy the written events and then check started_count to find those that were overwritten in the meantime,
+// like a seqlock.
+struct ThreadBuffer {
+  explicit ThreadBuffer(const uint32_t init_thread_id) : thread_id(init_thread_id) {}
+
+  // allocated by the owning thread before its first event, as many threads are never traced
+  std::unique_ptr<Event[]> events;
+  std::atomic<uint64_t> started_count{0};
+  std::atomic<uint64_t> written_count{0};
+
+  // the members below are protected by the mutex of the registry
+  const uint32_t thread_id;
+  std::string thread_name;
+  // number of events that were written when the buffer was cleared
+  uint64_t cleared_count = 0;
+  // set when the thread exits, so that the buffer can be dropped once it was cleared
+  bool thread_finished = false;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  uint32_t next_thread_id = 1;
+  std::unordered_set<std::string> interned_strings;
+};
+
+// never destroyed, as threads may exit after static objects are destroyed
+Registry& registry() {
+  static auto registry = new Registry{};
+  return *registry;
+}
+
+// registers the buffer of a thread on its first use and marks it as finished when the thread exits
+struct ThreadBufferHandle {
+  ~ThreadBufferHandle() {
+    if (!buffer) return;
+    auto lock = std::lock_guard(registry().mutex);
+    buffer->thread_finished = true;
+  }
+
+  ThreadBuffer& get() {
+    if (!buffer) {
+      auto& global_registry = registry();
+      auto lock = std::lock_guard(global_registry.mutex);
+      buffer = std::make_shared<ThreadBuffer>(global_registry.next_thread_id++);
+      global_registry.buffers.emplace_back(buffer);
+    }
+    return *buffer;
+  }
+
+  std::shared_ptr<ThreadBuffer> buffer;
+};
+
+thread_local auto thread_buffer_handle = ThreadBufferHandle{};
+
+const auto program_start = std::chrono::steady_clock::now();
+
+// prints the string as a JSON string literal
+void print_json_string(std::ostream& out, const char* string) {
+  out << '"';
+  for (auto character = string; *character; ++character) {
+    if (*character == '"' || *character == '\\') {
+      out << '\\' << *character;
+    } else if (static_cast<unsigned char>(*character) < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*character) << std::dec
+          << std::setfill(' ');
+    } else {
+      out << *character;
+    }
+  }
+  out << '"';
+}
+
+// prints nanoseconds as the microseconds used by the trace format
+void print_microseconds(std::ostream& out, const uint64_t nanoseconds) {
+  out << nanoseconds / 1'000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1'000 << std::setfill(' ');
+}
+
+}  // namespace
+
+std::atomic<bool> Tracer::_enabled{false};
+
+void Tracer::enable() { _enabled.store(true, std::memory_order_relaxed); }
+
+void Tracer::disable() { _enabled.store(false, std::memory_order_relaxed); }
+
+uint64_t Tracer::now() {
+  const auto elapsed = std::chrono::steady_clock::now() - program_start;
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Tracer::record(const char* category, const char* name, const uint64_t begin, const uint64_t end,
+                    const char* argument_name, const uint64_t argument) {
+  auto& buffer = thread_buffer_handle.get();
+  if (!buffer.events) buffer.events = std::make_unique<Event[]>(EVENTS_PER_THREAD);
+
+  const auto index = buffer.written_count.load(std::memory_order_relaxed);
+  buffer.started_count.store(index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  auto& event = buffer.events[index % EVENTS_PER_THREAD];
+  event.category.store(category, std::memory_order_relaxed);
+  event.name.store(name, std::memory_order_relaxed);
+  event.argument_name.store(argument_name, std::memory_order_relaxed);
+  event.argument.store(argument, std::memory_order_relaxed);
+  event.begin.store(begin, std::memory_order_relaxed);
+  event.end.store(end, std::memory_order_relaxed);
+
+  buffer.written_count.store(index + 1, std::memory_order_release);
+}
+
+const char* Tracer::intern(const std::string& string) {
+  auto& global_registry = registry();
+  auto lock = std::lock_guard(global_registry.mutex);
+  return global_registry.interned_strings.emplace(string).first->c_str();
+}
+
+void Tracer::set_thread_name(const std::string& name) {
+  auto& buffer = thread_buffer_handle.get();
+  auto lock = std::lock_guard(registry().mutex);
+  buffer.thread_name = name;
+}
+
+void Tracer::write_chrome_trace(std::ostream& out) {
+  auto& global_registry = registry();
+  auto lock = std::lock_guard(global_registry.mutex);
+
+  out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+  auto first_event = true;
+  const auto begin_event = [&]() {
+    out << (first_event ? "  " : ",\n  ");
+    first_event = false;
+  };
+
+  for (const auto& buffer : global_registry.buffers) {
+    if (!buffer->thread_name.empty()) {
+      begin_event();
+      out << "{\"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->thread_id
+          << ", \"name\": \"thread_name\", \"args\": {\"name\": ";
+      print_json_string(out, buffer->thread_name.c_str());
+      out << "}}";
+    }
+
+    const auto written_count = buffer->written_count.load(std::memory_order_acquire);
+    const auto first_index =
+        std::max(buffer->cleared_count, written_count > EVENTS_PER_THREAD ? written_count - EVENTS_PER_THREAD : 0);
+    auto events = std::vector<EventCopy>{};
+    for (auto index = first_index; index < written_count; ++index) {
+      const auto& event = buffer->events[index % EVENTS_PER_THREAD];
+      events.emplace_back(EventCopy{
+          event.category.load(std::memory_order_relaxed), event.name.load(std::memory_order_relaxed),
+          event.argument_name.load(std::memory_order_relaxed), event.argument.load(std::memory_order_relaxed),
+          event.begin.load(std::memory_order_relaxed), event.end.load(std::memory_order_relaxed)});
+    }
+
+    // events whose slots the thread started to overwrite may be torn
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto started_count = buffer->started_count.load(std::memory_order_relaxed);
+    const auto first_valid_index =
+        std::max(first_index, started_count > EVENTS_PER_THREAD ? started_count - EVENTS_PER_THREAD : 0);
+
+    for (auto index = first_valid_index; index < written_count; ++index) {
+      const auto& event = events[index - first_index];
+      begin_event();
+      out << "{\"ph\": \"X\", \"pid\": 1, \"tid\": " << buffer->thread_id << ", \"cat\": ";
+      print_json_string(out, event.category);
+      out << ", \"name\": ";
+      print_json_string(out, event.name);
+      out << ", \"ts\": ";
+      print_microseconds(out, event.begin);
+      out << ", \"dur\": ";
+      print_microseconds(out, event.end - event.begin);
+      if (event.argument_name) {
+        out << ", \"args\": {";
+        print_json_string(out, event.argument_name);
+        out << ": " << event.argument << "}";
+      }
+      out << "}";
+    }
+  }
+
+  out << "\n]}\n";
+}
+
+void Tracer::clear() {
+  auto& global_registry = registry();
+  auto lock = std::lock_guard(global_registry.mutex);
+
+  auto& buffers = global_registry.buffers;
+  const auto is_finished = [](const auto& buffer) { return buffer->thread_finished; };
+  buffers.erase(std::remove_if(buffers.begin(), buffers.end(), is_finished), buffers.end());
+  for (const auto& buffer : buffers) {
+    buffer->cleared_count = buffer->written_count.load(std::memory_order_acquire);
+  }
+}
+
+}  // namespace opossum
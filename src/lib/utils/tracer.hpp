@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The Tracer records when and on which thread instrumented pieces of work, e.g., operators or the scan of a chunk,
+// ran, so that a timeline of the execution can be viewed in chrome://tracing or Perfetto (https://ui.perfetto.dev).
+//
+// Tracing is disabled by default. Then, an instrumented scope costs a single relaxed load of a flag, so the
+// instrumentation stays in release builds. While tracing is enabled, every thread writes its events to its own ring
+// buffer without any synchronization with other threads. Once a buffer is full, the oldest events are overwritten.
+//
+// Example:
+//   {
+//     const auto trace_scope = Tracer::Scope{"storage", "compress_chunk", "chunk_id", chunk_id};
+//     ...
+//   }
+//
+//   Tracer::enable();
+//   query->execute();
+//   Tracer::disable();
+//   Tracer::write_chrome_trace(file);
+class Tracer : private Noncopyable {
+ public:
+  // maximum number of events kept per thread
+  static constexpr auto EVENTS_PER_THREAD = size_t{65'536};
+
+  static void enable();
+  static void disable();
+  static bool is_enabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  // returns the time since the start of the program in nanoseconds
+  static uint64_t now();
+
+  // Records an event of the calling thread. Category, name, and argument name need to outlive the Tracer, i.e., be
+  // string literals or interned (see intern). The argument is omitted if argument_name is nullptr.
+  static void record(const char* category, const char* name, const uint64_t begin, const uint64_t end,
+                     const char* argument_name = nullptr, const uint64_t argument = 0);
+
+  // returns a copy of the string that lives as long as the program, the same one for equal strings
+  static const char* intern(const std::string& string);
+
+  // names the calling thread in the trace, e.g., "worker 3"
+  static void set_thread_name(const std::string& name);
+
+  // Writes the events recorded since the last clear in the Chrome trace event format. Events that are overwritten
+  // while they are written are skipped, so this can be called while tracing is enabled.
+  static void write_chrome_trace(std::ostream& out);
+
+  // drops all events recorded so far
+  static void clear();
+
+  // records an event from its construction to its destruction if tracing is enabled on construction
+  class Scope : private Noncopyable {
+   public:
+    Scope(const char* category, const char* name, const char* argument_name = nullptr, const uint64_t argument = 0)
+        : _category(category), _name(name), _argument_name(argument_name), _argument(argument) {
+      if (is_enabled()) _begin = now();
+    }
+
+    ~Scope() {
+      if (_begin) record(_category, _name, *_begin, now(), _argument_name, _argument);
+    }
+
+   protected:
+    const char* const _category;
+    const char* const _name;
+    const char* const _argument_name;
+    const uint64_t _argument;
+    std::optional<uint64_t> _begin;
+  };
+
+ protected:
+  static std::atomic<bool> _enabled;
+};
+
+}  // namespace opossum
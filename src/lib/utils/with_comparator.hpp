@@ -0,0 +1,43 @@
+#pragma once
+
+#include <functional>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Resolves a ScanType into the matching comparison functor (e.g., std::less<> for ScanType::OpLessThan) and passes it
+ * on to a generic lambda. Because the switch happens once and not once per value, the compiler can inline the
+ * comparison into the loop of the caller.
+ *
+ * Example:
+ *
+ *   with_comparator(scan_type, [&](auto comparator) {
+ *     for (const auto& value : values) {
+ *       if (comparator(value, search_value)) ...
+ *     }
+ *   });
+ */
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return func(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return func(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return func(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return func(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return func(std::greater_equal<>{});
+    default:
+      Fail("Unknown scan operator");
+  }
+}
+
+}  // namespace opossum
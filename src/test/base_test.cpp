@@ -9,6 +9,7 @@
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
+#include "utils/performance_warning.hpp"
 
 namespace opossum {
 
@@ -31,6 +32,9 @@ void BaseTest::ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_p
 }
 
 BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
+  // comparing tables value by value is a slow path on purpose
+  PerformanceWarningDisabler pwd;
+
   // initialize matrix with table sizes
   Matrix matrix(table.row_count(), std::vector<AllTypeVariant>(table.column_count()));
 
@@ -7,7 +7,9 @@
 
 #include "../lib/storage/table.hpp"
 #include "../lib/storage/value_segment.hpp"
+#include "../lib/type_cast.hpp"
 #include "../lib/types.hpp"
+#include "../lib/utils/performance_warning.hpp"
 
 #include "gtest/gtest.h"
 
@@ -46,6 +48,25 @@ class BaseTest : public ::testing::Test {
   static void ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_ptr<const Table> tright,
                               bool order_sensitive = false, bool strict_types = true);
 
+  // returns the values of a column in order
+  template <typename T>
+  static std::vector<T> _column_values(const Table& table, const ColumnID column_id) {
+    PerformanceWarningDisabler pwd;
+    auto values = std::vector<T>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.emplace_back(type_cast<T>(segment[chunk_offset]));
+      }
+    }
+    return values;
+  }
+
+  template <typename T>
+  static std::vector<T> _column_values(const Table& table, const std::string& column_name) {
+    return _column_values<T>(table, table.column_id_by_name(column_name));
+  }
+
  public:
   virtual ~BaseTest();
 };
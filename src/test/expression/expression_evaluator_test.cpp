@@ -0,0 +1,82 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+class ExpressionEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "string");
+    _table->append({1, int64_t{10}, 0.5f, "x"});
+    _table->append({2, int64_t{20}, 1.5f, "y"});
+    _table->append({3, int64_t{30}, 2.5f, "z"});
+    _table->append({4, int64_t{40}, 3.5f, "y"});
+    _table->compress_chunk(ChunkID{0});
+  }
+
+  // returns the values of the expression for the first chunk, which is dictionary encoded
+  template <typename T>
+  std::vector<T> _evaluate(const ExpressionPointer& expression) {
+    const auto segment = ExpressionEvaluator{_table, ChunkID{0}}.evaluate_to_segment(*expression);
+    const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+    EXPECT_TRUE(value_segment);
+    return value_segment ? value_segment->values() : std::vector<T>{};
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ExpressionEvaluatorTest, Arithmetic) {
+  EXPECT_EQ(_evaluate<int32_t>(mul_(column_(ColumnID{0}), 2)), (std::vector<int32_t>{2, 4, 6}));
+  EXPECT_EQ(_evaluate<int32_t>(sub_(10, column_(ColumnID{0}))), (std::vector<int32_t>{9, 8, 7}));
+  EXPECT_EQ(_evaluate<int64_t>(add_(column_(ColumnID{0}), column_(ColumnID{1}))), (std::vector<int64_t>{11, 22, 33}));
+  EXPECT_EQ(_evaluate<float>(mul_(column_(ColumnID{0}), column_(ColumnID{2}))), (std::vector<float>{0.5f, 3.0f, 7.5f}));
+  EXPECT_EQ(_evaluate<double>(div_(column_(ColumnID{0}), 2.0)), (std::vector<double>{0.5, 1.0, 1.5}));
+
+  // integers are divided without remainder
+  EXPECT_EQ(_evaluate<int32_t>(div_(column_(ColumnID{0}), 2)), (std::vector<int32_t>{0, 1, 1}));
+  EXPECT_THROW(_evaluate<int32_t>(div_(column_(ColumnID{0}), 0)), std::logic_error);
+}
+
+TEST_F(ExpressionEvaluatorTest, NestedExpressionsAndLiterals) {
+  const auto expression = mul_(add_(column_(ColumnID{0}), 1), sub_(column_(ColumnID{1}), column_(ColumnID{0})));
+  EXPECT_EQ(_evaluate<int64_t>(expression), (std::vector<int64_t>{18, 54, 108}));
+  EXPECT_EQ(expression->description(*_table), "(a + 1) * (b - a)");
+
+  // literals are broadcast to all rows
+  EXPECT_EQ(_evaluate<int32_t>(add_(value_(20), 22)), (std::vector<int32_t>{42, 42, 42}));
+  EXPECT_EQ(_evaluate<std::string>(value_("s")), (std::vector<std::string>{"s", "s", "s"}));
+}
+
+TEST_F(ExpressionEvaluatorTest, Comparisons) {
+  EXPECT_EQ(_evaluate<int32_t>(greater_than_(column_(ColumnID{0}), 1)), (std::vector<int32_t>{0, 1, 1}));
+  EXPECT_EQ(_evaluate<int32_t>(less_than_equals_(column_(ColumnID{2}), column_(ColumnID{0}))),
+            (std::vector<int32_t>{1, 1, 1}));
+  EXPECT_EQ(_evaluate<int32_t>(equals_(column_(ColumnID{3}), "y")), (std::vector<int32_t>{0, 1, 0}));
+  EXPECT_EQ(_evaluate<int32_t>(not_equals_(column_(ColumnID{3}), "y")), (std::vector<int32_t>{1, 0, 1}));
+  EXPECT_EQ(greater_than_equals_(column_(ColumnID{3}), "y")->description(*_table), "d >= 'y'");
+}
+
+TEST_F(ExpressionEvaluatorTest, InvalidTypes) {
+  EXPECT_THROW(add_(column_(ColumnID{3}), 1)->data_type(*_table), std::logic_error);
+  EXPECT_THROW(add_(column_(ColumnID{3}), column_(ColumnID{3}))->data_type(*_table), std::logic_error);
+  EXPECT_THROW(equals_(column_(ColumnID{3}), 1)->data_type(*_table), std::logic_error);
+}
+
+}  // namespace opossum
@@ -4,7 +4,8 @@
 #include "utils/performance_warning.hpp"
 
 int main(int argc, char** argv) {
-  PerformanceWarningDisabler pwd;
+  // tests fail if they use a slow path without disabling the warnings, see PerformanceWarningDisabler
+  opossum::PerformanceWarnings::set_strict(true);
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
@@ -0,0 +1,229 @@
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/aggregate_input.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsAggregateTest, GroupByOneColumn) {
+  const auto expected_result = load_table("src/test/tables/aggregate_group_by_a.tbl", 2);
+
+  for (const auto worker_count : {0u, 1u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    auto aggregate = std::make_shared<Aggregate>(
+        _table_wrapper,
+        std::vector<AggregateDefinition>{{std::nullopt, AggregateFunction::Count},
+                                         {ColumnID{2}, AggregateFunction::Sum},
+                                         {ColumnID{1}, AggregateFunction::Min},
+                                         {ColumnID{2}, AggregateFunction::Max},
+                                         {ColumnID{2}, AggregateFunction::Avg}},
+        std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+    EXPECT_TABLE_EQ(aggregate->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, GroupByMultipleColumns) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  aggregate->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("b", "string");
+  expected_result->add_column("a", "int");
+  expected_result->add_column("COUNT(a)", "long");
+  expected_result->append({"x", 1, int64_t{2}});
+  expected_result->append({"y", 2, int64_t{1}});
+  expected_result->append({"z", 3, int64_t{2}});
+  expected_result->append({"x", 2, int64_t{1}});
+  expected_result->append({"y", 1, int64_t{1}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsAggregateTest, WithoutGroupBy) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper,
+      std::vector<AggregateDefinition>{{std::nullopt, AggregateFunction::Count}, {ColumnID{0}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{});
+  aggregate->execute();
+
+  const auto& output = aggregate->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"COUNT(*)", "SUM(a)"}));
+  EXPECT_EQ(output->column_type(ColumnID{1}), "long");
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ(type_cast<int64_t>((*output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[0]), 7);
+  EXPECT_EQ(type_cast<int64_t>((*output->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[0]), 13);
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryAndReferenceInputs) {
+  auto table = load_table("src/test/tables/aggregate_input.tbl", 2);
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{2});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 2);
+  scan->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper, scan}) {
+    auto aggregate = std::make_shared<Aggregate>(
+        input, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Sum}},
+        std::vector<ColumnID>{ColumnID{1}});
+    aggregate->execute();
+
+    auto expected_result = std::make_shared<Table>();
+    expected_result->add_column("b", "string");
+    expected_result->add_column("SUM(a)", "long");
+    if (input == scan) {
+      expected_result->append({"x", int64_t{2}});
+      expected_result->append({"y", int64_t{1}});
+    } else {
+      expected_result->append({"x", int64_t{4}});
+      expected_result->append({"y", int64_t{3}});
+    }
+    expected_result->append({"z", int64_t{6}});
+    EXPECT_TABLE_EQ(aggregate->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroups) {
+  WorkerPool::get().set_worker_count(4);
+
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("key", "long");
+  table->add_column("value", "double");
+  for (auto row = int64_t{0}; row < 20'000; ++row) table->append({row % 5'000, 0.5});
+  table->compress_chunk(ChunkID{7});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateDefinition>{{std::nullopt, AggregateFunction::Count}, {ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto& output = aggregate->get_output();
+  EXPECT_EQ(output->row_count(), 5'000u);
+  PerformanceWarningDisabler pwd;
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      EXPECT_EQ(type_cast<int64_t>((*chunk.get_segment(ColumnID{1}))[chunk_offset]), 4);
+      EXPECT_EQ(type_cast<double>((*chunk.get_segment(ColumnID{2}))[chunk_offset]), 2.0);
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateTest, GroupByDictionaryValueIDs) {
+  // dictionary encoded chunks are aggregated by value id, which has to match the results of the uncompressed table
+  auto uncompressed_table = std::make_shared<Table>(1'000);
+  auto compressed_table = std::make_shared<Table>(1'000);
+  for (const auto& table : {uncompressed_table, compressed_table}) {
+    table->add_column("key", "string");
+    table->add_column("value", "int");
+    for (auto row = 0; row < 10'000; ++row) {
+      // every chunk holds a different subset of the keys
+      table->append({"key" + std::to_string((row * 7) % (row / 1'000 * 30 + 50)), row % 13});
+    }
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1 < compressed_table->chunk_count(); chunk_id += 2) {
+    compressed_table->compress_chunk(chunk_id);
+  }
+
+  const auto aggregate_definitions = std::vector<AggregateDefinition>{{std::nullopt, AggregateFunction::Count},
+                                                                      {ColumnID{1}, AggregateFunction::Sum},
+                                                                      {ColumnID{1}, AggregateFunction::Min},
+                                                                      {ColumnID{1}, AggregateFunction::Max},
+                                                                      {ColumnID{1}, AggregateFunction::Avg}};
+  auto expected_input = std::make_shared<TableWrapper>(uncompressed_table);
+  expected_input->execute();
+  auto expected_aggregate =
+      std::make_shared<Aggregate>(expected_input, aggregate_definitions, std::vector<ColumnID>{ColumnID{0}});
+  expected_aggregate->execute();
+
+  for (const auto worker_count : {0u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    auto input = std::make_shared<TableWrapper>(compressed_table);
+    input->execute();
+    auto aggregate = std::make_shared<Aggregate>(input, aggregate_definitions, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+    EXPECT_TABLE_EQ(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Max}};
+  auto aggregate = std::make_shared<Aggregate>(scan, aggregates, std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+
+  EXPECT_EQ(aggregate->get_output()->row_count(), 0u);
+  EXPECT_EQ(aggregate->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInputWithoutGroupBy) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+  const auto aggregates = std::vector<AggregateDefinition>{
+      {std::nullopt, AggregateFunction::Count}, {ColumnID{0}, AggregateFunction::Sum},
+      {ColumnID{2}, AggregateFunction::Avg},    {ColumnID{1}, AggregateFunction::Min},
+      {ColumnID{0}, AggregateFunction::Max}};
+  auto aggregate = std::make_shared<Aggregate>(scan, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  // the global group exists even without rows
+  const auto& output = aggregate->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  const auto& chunk = output->get_chunk(ChunkID{0});
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ(type_cast<int64_t>((*chunk.get_segment(ColumnID{0}))[0]), 0);
+  EXPECT_EQ(type_cast<int64_t>((*chunk.get_segment(ColumnID{1}))[0]), 0);
+  EXPECT_TRUE(std::isnan(type_cast<double>((*chunk.get_segment(ColumnID{2}))[0])));
+  EXPECT_EQ(type_cast<std::string>((*chunk.get_segment(ColumnID{3}))[0]), "");
+  EXPECT_EQ(type_cast<int32_t>((*chunk.get_segment(ColumnID{4}))[0]), 0);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  EXPECT_THROW(std::make_shared<Aggregate>(_table_wrapper,
+                                           std::vector<AggregateDefinition>{{std::nullopt, AggregateFunction::Min}},
+                                           std::vector<ColumnID>{}),
+               std::logic_error);
+
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateDefinition>{{ColumnID{1}, AggregateFunction::Sum}}, std::vector<ColumnID>{});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/intersect_positions.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIntersectPositionsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    for (auto row = 0; row < 1'000; ++row) table->append({row, row % 7});
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{9}; chunk_id += 2) {
+      table->compress_chunk(chunk_id);
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableScan> _scan(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper, column_id, scan_type, value);
+    scan->execute();
+    return scan;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIntersectPositionsTest, Conjunction) {
+  const auto previous_worker_count = WorkerPool::get().worker_count();
+  WorkerPool::get().set_worker_count(4);
+
+  // both a dense (bitmap) and a sparse (offsets) list of positions, i.e., 150 <= a < 850 AND b = 3
+  auto range = std::make_shared<IntersectPositions>(_scan(ColumnID{0}, ScanType::OpGreaterThanEquals, 150),
+                                                    _scan(ColumnID{0}, ScanType::OpLessThan, 850));
+  range->execute();
+  auto intersect = std::make_shared<IntersectPositions>(range, _scan(ColumnID{1}, ScanType::OpEquals, 3));
+  intersect->execute();
+
+  auto expected_values = std::vector<int32_t>{};
+  for (auto value = 150; value < 850; ++value) {
+    if (value % 7 == 3) expected_values.emplace_back(value);
+  }
+  EXPECT_EQ(_column_values<int32_t>(*intersect->get_output(), ColumnID{0}), expected_values);
+
+  WorkerPool::get().set_worker_count(previous_worker_count);
+}
+
+TEST_F(OperatorsIntersectPositionsTest, EmptyResult) {
+  auto intersect = std::make_shared<IntersectPositions>(_scan(ColumnID{0}, ScanType::OpLessThan, 100),
+                                                        _scan(ColumnID{0}, ScanType::OpGreaterThan, 900));
+  intersect->execute();
+
+  const auto& output = *intersect->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.chunk_count(), 1u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsIntersectPositionsTest, ChecksEveryChunk) {
+  // the second chunk of the right input references the columns in the wrong order
+  const auto referenced_table = _table_wrapper->get_output();
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column_definition("a", "int");
+  right_table->add_column_definition("b", "int");
+  for (const auto& column_ids : {std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}, {ColumnID{1}, ColumnID{0}}}) {
+    const auto positions = std::make_shared<const PosList>(PosList{RowID{ChunkID{0}, 1}});
+    auto chunk = std::make_shared<Chunk>();
+    for (const auto& column_id : column_ids) {
+      chunk->add_segment(std::make_shared<ReferenceSegment>(referenced_table, column_id, positions));
+    }
+    right_table->emplace_chunk(chunk);
+  }
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  auto intersect = std::make_shared<IntersectPositions>(_scan(ColumnID{0}, ScanType::OpLessThan, 100), right);
+  EXPECT_THROW(intersect->execute(), std::logic_error);
+}
+
+}  // namespace opossum
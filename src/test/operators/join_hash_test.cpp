@@ -0,0 +1,204 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    _table_wrapper_left->execute();
+    _table_wrapper_right = std::make_shared<TableWrapper>(load_table("src/test/tables/join_right.tbl", 2));
+    _table_wrapper_right->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsJoinHashTest, InnerEquiJoin) {
+  const auto expected_result = load_table("src/test/tables/join_inner.tbl", 2);
+
+  for (const auto worker_count : {0u, 1u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                           std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+    join->execute();
+    EXPECT_TABLE_EQ(join->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, BuildsOnTheSmallerSide) {
+  const auto expected_result = load_table("src/test/tables/join_inner.tbl", 2);
+
+  // the right input is smaller here, so it is used to build the hash tables
+  auto scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpLessThan, 8);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), expected_result);
+}
+
+TEST_F(OperatorsJoinHashTest, ReferencesOriginalTables) {
+  auto left_table = load_table("src/test/tables/join_left.tbl", 2);
+  left_table->compress_chunk(ChunkID{0});
+  left_table->compress_chunk(ChunkID{1});
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+
+  auto scan = std::make_shared<TableScan>(left, ColumnID{0}, ScanType::OpGreaterThanEquals, 3);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(scan, _table_wrapper_right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", "int");
+  expected_result->add_column("b", "string");
+  expected_result->add_column("c", "int");
+  expected_result->add_column("d", "float");
+  expected_result->append({3, "three", 3, 3.5f});
+  expected_result->append({3, "three", 3, 3.25f});
+  expected_result->append({7, "seven", 7, 7.5f});
+  EXPECT_TABLE_EQ(join->get_output(), expected_result);
+
+  // the output references the table that the scan references, not the scan output itself
+  const auto& chunk = join->get_output()->get_chunk(ChunkID{0});
+  const auto left_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{1}));
+  const auto right_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{2}));
+  ASSERT_TRUE(left_segment && right_segment);
+  EXPECT_EQ(left_segment->referenced_table(), left_table);
+  EXPECT_EQ(right_segment->referenced_table(), _table_wrapper_right->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, StringSelfJoin) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_left,
+                                         std::make_pair(ColumnID{1}, ColumnID{1}));
+  join->execute();
+
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 6u);
+  EXPECT_EQ(output->column_names(), (std::vector<std::string>{"a", "b", "a_right", "b_right"}));
+}
+
+TEST_F(OperatorsJoinHashTest, ChainedSelfJoin) {
+  // the left input of the second join already has the columns a_right and b_right
+  auto first_join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_left,
+                                               std::make_pair(ColumnID{1}, ColumnID{1}));
+  first_join->execute();
+  auto second_join =
+      std::make_shared<JoinHash>(first_join, _table_wrapper_left, std::make_pair(ColumnID{1}, ColumnID{1}));
+  second_join->execute();
+
+  const auto& output = second_join->get_output();
+  EXPECT_EQ(output->row_count(), 6u);
+  EXPECT_EQ(output->column_names(),
+            (std::vector<std::string>{"a", "b", "a_right", "b_right", "a_right_right", "b_right_right"}));
+
+  auto third_join = std::make_shared<JoinHash>(second_join, first_join, std::make_pair(ColumnID{1}, ColumnID{1}));
+  third_join->execute();
+  EXPECT_EQ(third_join->get_output()->column_names(),
+            (std::vector<std::string>{"a", "b", "a_right", "b_right", "a_right_right", "b_right_right",
+                                      "a_right_right_right", "b_right_right_right", "a_right_right_right_right",
+                                      "b_right_right_right_right"}));
+}
+
+TEST_F(OperatorsJoinHashTest, NoMatches) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpEquals, 4);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->chunk_count(), ChunkID{1});
+  EXPECT_EQ(join->get_output()->get_chunk(ChunkID{0}).column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinHashTest, ManyPartitions) {
+  WorkerPool::get().set_worker_count(4);
+
+  auto left_table = std::make_shared<Table>(100);
+  left_table->add_column("a", "long");
+  for (auto row = int64_t{0}; row < 10'000; ++row) left_table->append({row % 1'000});
+  auto right_table = std::make_shared<Table>(100);
+  right_table->add_column("b", "long");
+  for (auto row = int64_t{0}; row < 2'000; ++row) right_table->append({row});
+  right_table->compress_chunk(ChunkID{3});
+
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  auto join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 10'000u);
+  EXPECT_GT(output->chunk_count(), ChunkID{1});
+  PerformanceWarningDisabler pwd;
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], (*chunk.get_segment(ColumnID{1}))[chunk_offset]);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, SplitsOutputIntoChunks) {
+  // a single worker uses a single partition here, whose matches exceed the chunk size of the inputs
+  WorkerPool::get().set_worker_count(1);
+
+  auto left_table = std::make_shared<Table>(10);
+  left_table->add_column("a", "int");
+  for (auto row = 0; row < 100; ++row) left_table->append({row % 2});
+  auto right_table = std::make_shared<Table>(20);
+  right_table->add_column("b", "int");
+  for (auto row = 0; row < 10; ++row) right_table->append({row % 2});
+
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  auto join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 500u);
+  EXPECT_EQ(output->chunk_size(), 20u);
+  EXPECT_EQ(output->chunk_count(), ChunkID{25});
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id).size(), 20u);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, RejectsInvalidJoins) {
+  EXPECT_THROW(std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                          std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpLessThan),
+               std::logic_error);
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper_left, _table_wrapper_right,
+                                         std::make_pair(ColumnID{0}, ColumnID{1}));
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+}  // namespace opossum
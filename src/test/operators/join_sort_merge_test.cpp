@@ -0,0 +1,184 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/with_comparator.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    _table_wrapper_left->execute();
+    _table_wrapper_right = std::make_shared<TableWrapper>(load_table("src/test/tables/join_right.tbl", 2));
+    _table_wrapper_right->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  // joins the int columns a and c of the test tables with nested loops
+  std::shared_ptr<Table> _nested_loop_join(const ScanType scan_type) {
+    const auto& left = *_table_wrapper_left->get_output();
+    const auto& right = *_table_wrapper_right->get_output();
+
+    PerformanceWarningDisabler pwd;
+    auto result = std::make_shared<Table>();
+    result->add_column("a", "int");
+    result->add_column("b", "string");
+    result->add_column("c", "int");
+    result->add_column("d", "float");
+
+    with_comparator(scan_type, [&](auto comparator) {
+      for (auto left_chunk_id = ChunkID{0}; left_chunk_id < left.chunk_count(); ++left_chunk_id) {
+        const auto& left_chunk = left.get_chunk(left_chunk_id);
+        for (auto left_offset = ChunkOffset{0}; left_offset < left_chunk.size(); ++left_offset) {
+          for (auto right_chunk_id = ChunkID{0}; right_chunk_id < right.chunk_count(); ++right_chunk_id) {
+            const auto& right_chunk = right.get_chunk(right_chunk_id);
+            for (auto right_offset = ChunkOffset{0}; right_offset < right_chunk.size(); ++right_offset) {
+              const auto left_value = (*left_chunk.get_segment(ColumnID{0}))[left_offset];
+              const auto right_value = (*right_chunk.get_segment(ColumnID{0}))[right_offset];
+              if (!comparator(type_cast<int32_t>(left_value), type_cast<int32_t>(right_value))) continue;
+              result->append({left_value, (*left_chunk.get_segment(ColumnID{1}))[left_offset], right_value,
+                              (*right_chunk.get_segment(ColumnID{1}))[right_offset]});
+            }
+          }
+        }
+      }
+    });
+
+    return result;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, InnerEquiJoin) {
+  const auto expected_result = load_table("src/test/tables/join_inner.tbl", 2);
+
+  for (const auto worker_count : {0u, 1u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    auto join = std::make_shared<JoinSortMerge>(_table_wrapper_left, _table_wrapper_right,
+                                                std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+    join->execute();
+    EXPECT_TABLE_EQ(join->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, InequalityJoins) {
+  for (const auto scan_type : {ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+                               ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    auto join = std::make_shared<JoinSortMerge>(_table_wrapper_left, _table_wrapper_right,
+                                                std::make_pair(ColumnID{0}, ColumnID{0}), scan_type);
+    join->execute();
+    EXPECT_TABLE_EQ(join->get_output(), _nested_loop_join(scan_type));
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, ReferenceAndDictionaryInputs) {
+  auto right_table = load_table("src/test/tables/join_right.tbl", 2);
+  right_table->compress_chunk(ChunkID{0});
+  right_table->compress_chunk(ChunkID{1});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto scan = std::make_shared<TableScan>(right, ColumnID{0}, ScanType::OpNotEquals, 3);
+  scan->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(_table_wrapper_left, scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", "int");
+  expected_result->add_column("b", "string");
+  expected_result->add_column("c", "int");
+  expected_result->add_column("d", "float");
+  expected_result->append({2, "two", 2, 2.5f});
+  expected_result->append({2, "two_again", 2, 2.5f});
+  expected_result->append({7, "seven", 7, 7.5f});
+  EXPECT_TABLE_EQ(join->get_output(), expected_result);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, MatchesJoinHash) {
+  WorkerPool::get().set_worker_count(4);
+
+  // the left input is ordered on the join column, the right one is not
+  auto left_table = std::make_shared<Table>(100);
+  left_table->add_column("a", "string");
+  for (auto row = 0; row < 3'000; ++row) left_table->append({std::to_string(1'000 + row / 3)});
+  left_table->compress_chunk(ChunkID{5});
+  auto right_table = std::make_shared<Table>(64);
+  right_table->add_column("b", "string");
+  for (auto row = 0; row < 2'000; ++row) right_table->append({std::to_string(1'000 + (row * 7919) % 1'500)});
+
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  auto sort_merge_join = std::make_shared<JoinSortMerge>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  sort_merge_join->execute();
+  auto hash_join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  hash_join->execute();
+
+  // the first 1'500 right rows hit every left value three times
+  EXPECT_GE(sort_merge_join->get_output()->row_count(), 3'000u);
+  EXPECT_TABLE_EQ(sort_merge_join->get_output(), hash_join->get_output());
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SplitsOutputIntoChunks) {
+  WorkerPool::get().set_worker_count(1);
+
+  auto left_table = std::make_shared<Table>(10);
+  left_table->add_column("a", "int");
+  for (auto row = 0; row < 100; ++row) left_table->append({row});
+  auto right_table = std::make_shared<Table>(20);
+  right_table->add_column("b", "int");
+  for (auto row = 0; row < 30; ++row) right_table->append({row});
+
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // almost every pair matches, which are written into chunks of the larger chunk size of both inputs
+  auto join = std::make_shared<JoinSortMerge>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpNotEquals);
+  join->execute();
+
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 2'970u);
+  EXPECT_EQ(output->chunk_size(), 20u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_LE(output->get_chunk(chunk_id).size(), 20u);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_left, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(scan, _table_wrapper_right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpLessThan);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 45; ++row) table->append({row, std::to_string(row)});
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, DataInput) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 23);
+  limit->execute();
+
+  const auto& output = *limit->get_output();
+  EXPECT_EQ(output.row_count(), 23u);
+  EXPECT_EQ(output.chunk_count(), 3u);
+  EXPECT_EQ(output.get_chunk(ChunkID{2}).size(), 3u);
+  EXPECT_EQ(output.column_names(), _table_wrapper->get_output()->column_names());
+
+  auto expected_values = std::vector<int32_t>{};
+  for (auto value = 0; value < 23; ++value) expected_values.emplace_back(value);
+  EXPECT_EQ(_column_values<int32_t>(output, ColumnID{0}), expected_values);
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ(type_cast<std::string>((*output.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[4]), "14");
+}
+
+TEST_F(OperatorsLimitTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 5);
+  scan->execute();
+  auto limit = std::make_shared<Limit>(scan, 12);
+  limit->execute();
+
+  const auto& output = *limit->get_output();
+  EXPECT_EQ(_column_values<int32_t>(output, ColumnID{0}),
+            (std::vector<int32_t>{5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}));
+
+  // complete chunks of ReferenceSegments are passed on, the last chunk references the original table
+  const auto& scan_output = *scan->get_output();
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).get_segment(ColumnID{1}),
+            scan_output.get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  const auto last_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output.get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(last_segment);
+  EXPECT_EQ(last_segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsLimitTest, MoreRowsThanInput) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 1'000);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), _table_wrapper->get_output(), true);
+}
+
+TEST_F(OperatorsLimitTest, NoRows) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 0);
+  limit->execute();
+
+  const auto& output = *limit->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.chunk_count(), 1u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/materialize.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+    WorkerPool::get().set_worker_count(4);
+
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "double");
+    for (auto row = 0; row < 45; ++row) table->append({row, "value" + std::to_string(row % 7), row * 0.5});
+    table->compress_chunk(ChunkID{1});
+    table->compress_chunk(ChunkID{3});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  // checks that all segments of the table are of the given kind
+  template <template <typename> class SegmentType>
+  static void _expect_segments(const Table& table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      EXPECT_TRUE(std::dynamic_pointer_cast<const SegmentType<int32_t>>(chunk.get_segment(ColumnID{0})));
+      EXPECT_TRUE(std::dynamic_pointer_cast<const SegmentType<std::string>>(chunk.get_segment(ColumnID{1})));
+      EXPECT_TRUE(std::dynamic_pointer_cast<const SegmentType<double>>(chunk.get_segment(ColumnID{2})));
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsMaterializeTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpNotEquals, "value3");
+  scan->execute();
+
+  for (const auto encoding : {MaterializeEncoding::Value, MaterializeEncoding::Dictionary}) {
+    auto materialize = std::make_shared<Materialize>(scan, encoding);
+    materialize->execute();
+
+    const auto& output = *materialize->get_output();
+    EXPECT_TABLE_EQ(materialize->get_output(), scan->get_output(), true, true);
+    ASSERT_EQ(output.chunk_count(), scan->get_output()->chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+      EXPECT_EQ(output.get_chunk(chunk_id).size(), scan->get_output()->get_chunk(chunk_id).size());
+    }
+
+    if (encoding == MaterializeEncoding::Value) {
+      _expect_segments<ValueSegment>(output);
+    } else {
+      _expect_segments<DictionarySegment>(output);
+    }
+  }
+}
+
+TEST_F(OperatorsMaterializeTest, JoinInput) {
+  // the columns of a join output reference different tables, and their positions are not clustered by chunk
+  auto join = std::make_shared<JoinHash>(_table_wrapper, _table_wrapper, std::make_pair(ColumnID{1}, ColumnID{1}),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  auto materialize = std::make_shared<Materialize>(join);
+  materialize->execute();
+  EXPECT_TABLE_EQ(materialize->get_output(), join->get_output(), true, true);
+}
+
+TEST_F(OperatorsMaterializeTest, DataInput) {
+  auto materialize = std::make_shared<Materialize>(_table_wrapper, MaterializeEncoding::Dictionary);
+  materialize->execute();
+
+  const auto& input = *_table_wrapper->get_output();
+  const auto& output = *materialize->get_output();
+  EXPECT_TABLE_EQ(materialize->get_output(), _table_wrapper->get_output(), true, true);
+  _expect_segments<DictionarySegment>(output);
+
+  // dictionary segments are immutable and therefore not copied
+  for (const auto& chunk_id : {ChunkID{0}, ChunkID{1}}) {
+    const auto& input_segment = input.get_chunk(chunk_id).get_segment(ColumnID{1});
+    EXPECT_EQ(output.get_chunk(chunk_id).get_segment(ColumnID{1}) == input_segment, chunk_id == ChunkID{1});
+  }
+}
+
+TEST_F(OperatorsMaterializeTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto materialize = std::make_shared<Materialize>(scan);
+  materialize->execute();
+
+  const auto& output = *materialize->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.column_names(), _table_wrapper->get_output()->column_names());
+  EXPECT_EQ(output.chunk_count(), 1u);
+  _expect_segments<ValueSegment>(output);
+}
+
+}  // namespace opossum
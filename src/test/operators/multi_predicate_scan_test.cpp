@@ -0,0 +1,163 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/multi_predicate_scan.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class OperatorsMultiPredicateScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    table->add_column("c", "string");
+    for (int i = 0; i <= 24; i += 2) table->append({i, 100 + i, std::to_string(i % 3)});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper_dict = std::make_shared<TableWrapper>(table);
+    _table_wrapper_dict->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_dict;
+};
+
+TEST_F(OperatorsMultiPredicateScanTest, MatchesChainedTableScans) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan = std::make_shared<MultiPredicateScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 1234},
+                                                 {ColumnID{1}, ScanType::OpLessThan, 457.9}});
+  scan->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, PartiallyCompressedTable) {
+  // chunks 0 and 1 are dictionary encoded, chunk 2 is not
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    auto scan = std::make_shared<MultiPredicateScan>(
+        _table_wrapper_dict, std::vector<ScanPredicate>{{ColumnID{0}, scan_type, 12},
+                                                        {ColumnID{1}, ScanType::OpNotEquals, 108},
+                                                        {ColumnID{2}, ScanType::OpNotEquals, "2"}});
+    scan->execute();
+
+    auto scan_1 = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, scan_type, 12);
+    scan_1->execute();
+    auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpNotEquals, 108);
+    scan_2->execute();
+    auto scan_3 = std::make_shared<TableScan>(scan_2, ColumnID{2}, ScanType::OpNotEquals, "2");
+    scan_3->execute();
+
+    EXPECT_TABLE_EQ(scan->get_output(), scan_3->get_output());
+  }
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, ScanOnReferenceSegments) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, ScanType::OpGreaterThan, 6);
+  table_scan->execute();
+
+  auto scan = std::make_shared<MultiPredicateScan>(
+      table_scan, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpLessThan, 20},
+                                             {ColumnID{1}, ScanType::OpGreaterThanEquals, 112}});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 4u);
+
+  // the output references the base table, not the output of the table scan
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper_dict->get_output());
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ((*segment)[0], AllTypeVariant{12});
+  EXPECT_EQ((*segment)[3], AllTypeVariant{18});
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, ScanOnPositionsSpanningChunks) {
+  // the sorted output references all chunks of the input in a single PosList
+  auto sort = std::make_shared<Sort>(_table_wrapper_dict, ColumnID{2}, OrderByMode::Descending);
+  sort->execute();
+
+  auto scan = std::make_shared<MultiPredicateScan>(
+      sort, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThan, 4},
+                                       {ColumnID{2}, ScanType::OpNotEquals, "1"}});
+  scan->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(sort, ColumnID{0}, ScanType::OpGreaterThan, 4);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{2}, ScanType::OpNotEquals, "1");
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), scan_2->get_output());
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, OutputsOneChunkPerInputChunk) {
+  // a > 8 AND a != 12 matches rows of the input chunks 1 and 2
+  auto scan = std::make_shared<MultiPredicateScan>(
+      _table_wrapper_dict, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThan, 8},
+                                                      {ColumnID{0}, ScanType::OpNotEquals, 12}});
+  scan->execute();
+
+  const auto& output = scan->get_output();
+  ASSERT_EQ(output->chunk_count(), ChunkID{2});
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).size(), 4u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).size(), 3u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id).get_segment(ColumnID{0}));
+    ASSERT_NE(segment, nullptr);
+    EXPECT_NE(segment->chunk_pos_list(), nullptr);
+  }
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, ScanWithRuntimeFilter) {
+  auto build_table = std::make_shared<Table>(2);
+  build_table->add_column("id", "int");
+  for (const auto id : {5, 4, 22, 10, 16}) build_table->append({id});
+  auto build_wrapper = std::make_shared<TableWrapper>(build_table);
+  build_wrapper->execute();
+
+  // of the rows 4 <= a < 20, only those whose a is in the build table remain
+  auto scan = std::make_shared<MultiPredicateScan>(
+      _table_wrapper_dict, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 4},
+                                                      {ColumnID{0}, ScanType::OpLessThan, 20}});
+  scan->set_runtime_filter(build_wrapper, ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(scan->input_right(), build_wrapper);
+  scan->execute();
+
+  EXPECT_EQ(_column_values<int32_t>(*scan->get_output(), ColumnID{0}), (std::vector<int32_t>{4, 10, 16}));
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, EmptyResult) {
+  auto scan = std::make_shared<MultiPredicateScan>(
+      _table_wrapper_dict, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpLessThan, 10},
+                                                      {ColumnID{1}, ScanType::OpGreaterThan, 200}});
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+TEST_F(OperatorsMultiPredicateScanTest, NeedsPredicates) {
+  EXPECT_THROW(MultiPredicateScan(_table_wrapper, {}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+class OperatorsPerformanceDataTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    // 1000 rows in chunks of 100 rows
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 1'000; ++row) table->append({row, "value" + std::to_string(row % 10)});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsPerformanceDataTest, RecordsExecution) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 150);
+  EXPECT_FALSE(scan->performance_data().executed);
+  EXPECT_EQ(scan->performance_data().to_string(), "not executed");
+  scan->execute();
+
+  const auto& performance_data = scan->performance_data();
+  EXPECT_TRUE(performance_data.executed);
+  EXPECT_FALSE(performance_data.pipelined);
+  EXPECT_GT(performance_data.walltime.count(), 0);
+  EXPECT_EQ(performance_data.input_row_count, 1'000u);
+  EXPECT_EQ(performance_data.input_chunk_count, 10u);
+  EXPECT_EQ(performance_data.output_row_count, 150u);
+  EXPECT_EQ(performance_data.output_chunk_count, 2u);
+  EXPECT_EQ(performance_data.output_bytes, scan->get_output()->estimate_memory_usage());
+  EXPECT_NE(performance_data.to_string().find("1000 -> 150 rows, 10 -> 2 chunks"), std::string::npos);
+
+  // the inputs of both sides are counted
+  auto join = std::make_shared<JoinHash>(scan, _table_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  join->execute();
+  EXPECT_EQ(join->performance_data().input_row_count, 1'150u);
+  EXPECT_EQ(join->performance_data().output_row_count, 150u);
+}
+
+TEST_F(OperatorsPerformanceDataTest, ChargesCpuTimeOfWorkers) {
+  WorkerPool::get().set_worker_count(4);
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{1});
+
+  // the CPU time of the calling thread alone may be far less than the wall time, as it waits for the workers
+  sort->execute();
+  const auto& performance_data = sort->performance_data();
+  EXPECT_GT(performance_data.cpu_time.count(), 0);
+  EXPECT_EQ(performance_data.output_row_count, 1'000u);
+}
+
+TEST_F(OperatorsPerformanceDataTest, Pipelines) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 250);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{0}, ScanType::OpLessThan, 420);
+  auto projection = std::make_shared<Projection>(scan_b, std::vector<ExpressionPointer>{column_(ColumnID{1})});
+  Scheduler::execute(projection, ExecutionMode::Pipelined);
+
+  // the times of the pipeline are recorded for its last operator
+  EXPECT_TRUE(projection->performance_data().pipelined);
+  EXPECT_GT(projection->performance_data().walltime.count(), 0);
+  EXPECT_EQ(projection->performance_data().input_row_count, 1'000u);
+  EXPECT_EQ(projection->performance_data().output_row_count, 170u);
+  EXPECT_EQ(projection->performance_data().output_chunk_count, 3u);
+
+  // chunks without rows are not passed on, except for the first one
+  const auto& scan_a_data = scan_a->performance_data();
+  EXPECT_TRUE(scan_a_data.executed);
+  EXPECT_TRUE(scan_a_data.pipelined);
+  EXPECT_EQ(scan_a_data.walltime.count(), 0);
+  EXPECT_EQ(scan_a_data.input_row_count, 1'000u);
+  EXPECT_EQ(scan_a_data.input_chunk_count, 10u);
+  EXPECT_EQ(scan_a_data.output_row_count, 750u);
+  EXPECT_EQ(scan_a_data.output_chunk_count, 9u);
+
+  const auto& scan_b_data = scan_b->performance_data();
+  EXPECT_EQ(scan_b_data.input_row_count, 750u);
+  EXPECT_EQ(scan_b_data.input_chunk_count, 9u);
+  EXPECT_EQ(scan_b_data.output_row_count, 170u);
+  EXPECT_EQ(scan_b_data.output_chunk_count, 4u);
+  EXPECT_EQ(scan_b_data.to_string(), "pipelined, 750 -> 170 rows, 9 -> 4 chunks");
+}
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("price", "double");
+    table->add_column("quantity", "int");
+    table->add_column("name", "string");
+    table->append({2.5, 4, "a"});
+    table->append({1.0, 3, "b"});
+    table->append({4.0, 1, "c"});
+    table->append({0.5, 8, "d"});
+    table->append({3.0, 2, "e"});
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, ComputedAndSelectedColumns) {
+  const auto expressions = std::vector<ExpressionPointer>{
+      column_(ColumnID{2}), mul_(column_(ColumnID{0}), column_(ColumnID{1})), greater_than_(column_(ColumnID{1}), 2)};
+  auto projection = std::make_shared<Projection>(_table_wrapper, expressions);
+  projection->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("name", "string");
+  expected_result->add_column("price * quantity", "double");
+  expected_result->add_column("quantity > 2", "int");
+  expected_result->append({"a", 10.0, 1});
+  expected_result->append({"b", 3.0, 1});
+  expected_result->append({"c", 4.0, 0});
+  expected_result->append({"d", 4.0, 1});
+  expected_result->append({"e", 6.0, 0});
+  EXPECT_TABLE_EQ(projection->get_output(), expected_result, true, true);
+
+  // the output consists of ReferenceSegments in chunks that correspond to the input chunks
+  const auto& output = *projection->get_output();
+  EXPECT_EQ(output.chunk_count(), 3u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    for (auto column_id = ColumnID{0}; column_id < output.column_count(); ++column_id) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<const ReferenceSegment>(output.get_chunk(chunk_id).get_segment(column_id)));
+    }
+  }
+  const auto selected_segment =
+      std::static_pointer_cast<const ReferenceSegment>(output.get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  EXPECT_EQ(selected_segment->referenced_table(), _table_wrapper->get_output());
+  EXPECT_EQ(selected_segment->referenced_column_id(), ColumnID{2});
+}
+
+TEST_F(OperatorsProjectionTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  auto projection = std::make_shared<Projection>(
+      scan, std::vector<ExpressionPointer>{column_(ColumnID{1}), sub_(column_(ColumnID{0}), 0.5)});
+  projection->execute();
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("quantity", "int");
+  expected_result->add_column("price - 0.5", "double");
+  expected_result->append({4, 2.0});
+  expected_result->append({3, 0.5});
+  expected_result->append({8, 0.0});
+  expected_result->append({2, 2.5});
+  EXPECT_TABLE_EQ(projection->get_output(), expected_result, true, true);
+
+  // selected columns of a reference input are passed on without copying them
+  const auto& output = *projection->get_output();
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).get_segment(ColumnID{0}),
+            scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+
+  // the output can be processed further, e.g., scanned and joined
+  auto computed_scan = std::make_shared<TableScan>(projection, ColumnID{1}, ScanType::OpGreaterThanEquals, 2.0);
+  computed_scan->execute();
+  auto join = std::make_shared<JoinHash>(computed_scan, _table_wrapper, std::make_pair(ColumnID{0}, ColumnID{1}));
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsProjectionTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto projection = std::make_shared<Projection>(
+      scan, std::vector<ExpressionPointer>{column_(ColumnID{2}), add_(column_(ColumnID{1}), 1)});
+  projection->execute();
+
+  const auto& output = *projection->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.column_names(), (std::vector<std::string>{"name", "quantity + 1"}));
+  EXPECT_EQ(output.column_type(ColumnID{1}), "int");
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsProjectionTest, DuplicateExpressions) {
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<ExpressionPointer>{column_(ColumnID{1}), column_(ColumnID{1}), column_(ColumnID{1}),
+                                                     add_(column_(ColumnID{1}), 1), add_(column_(ColumnID{1}), 1)});
+  projection->execute();
+
+  const auto& output = *projection->get_output();
+  EXPECT_EQ(output.column_names(), (std::vector<std::string>{"quantity", "quantity_2", "quantity_3", "quantity + 1",
+                                                             "quantity + 1_2"}));
+
+  auto expected_result = std::make_shared<Table>(2);
+  for (const auto& column_name : output.column_names()) expected_result->add_column(column_name, "int");
+  expected_result->append({4, 4, 4, 5, 5});
+  expected_result->append({3, 3, 3, 4, 4});
+  expected_result->append({1, 1, 1, 2, 2});
+  expected_result->append({8, 8, 8, 9, 9});
+  expected_result->append({2, 2, 2, 3, 3});
+  EXPECT_TABLE_EQ(projection->get_output(), expected_result);
+}
+
+}  // namespace opossum
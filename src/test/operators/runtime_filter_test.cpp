@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/runtime_filter.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsRuntimeFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // even numbers from 0 to 1998 and their string representations, partially dictionary encoded
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto value = 0; value < 2'000; value += 2) _table->append({value, std::to_string(value)});
+    _table->compress_chunk(ChunkID{3});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsRuntimeFilterTest, MayContain) {
+  const auto int_filter = RuntimeFilter{*_table, ColumnID{0}};
+  const auto string_filter = RuntimeFilter{*_table, ColumnID{1}};
+  EXPECT_EQ(int_filter.data_type(), "int");
+  EXPECT_EQ(string_filter.data_type(), "string");
+
+  // there are no false negatives, and few false positives
+  auto false_positive_count = 0;
+  for (auto value = 0; value < 2'000; ++value) {
+    const auto is_contained = value % 2 == 0;
+    if (is_contained) {
+      EXPECT_TRUE(int_filter.may_contain(value));
+      EXPECT_TRUE(string_filter.may_contain(std::to_string(value)));
+    } else {
+      false_positive_count += int_filter.may_contain(value);
+      false_positive_count += string_filter.may_contain(std::to_string(value));
+    }
+  }
+  EXPECT_LT(false_positive_count, 40);
+}
+
+TEST_F(OperatorsRuntimeFilterTest, FilterSegments) {
+  auto build_table = std::make_shared<Table>(10);
+  build_table->add_column("a", "int");
+  for (const auto value : {150, 300, 302, 310, 610, 1'998}) build_table->append({value});
+  const auto filter = RuntimeFilter{*build_table, ColumnID{0}};
+
+  // Chunk 1 holds a value segment, chunk 3 a dictionary segment. Offsets of contained values are kept, other offsets
+  // are only kept as false positives.
+  const auto expect_filtered = [&](const BaseSegment& segment, std::vector<ChunkOffset> offsets,
+                                   const std::vector<ChunkOffset>& contained_offsets) {
+    filter.filter(segment, offsets);
+    EXPECT_TRUE(std::includes(offsets.cbegin(), offsets.cend(), contained_offsets.cbegin(), contained_offsets.cend()));
+    EXPECT_LE(offsets.size(), contained_offsets.size() + 1);
+  };
+
+  expect_filtered(*_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}), {0, 50, 51, 52, 55, 99}, {50, 51, 55});
+
+  // with few offsets, the rows are checked directly instead of the dictionary
+  const auto& dictionary_segment = *_table->get_chunk(ChunkID{3}).get_segment(ColumnID{0});
+  expect_filtered(dictionary_segment, {0, 1}, {});
+  auto offsets = std::vector<ChunkOffset>(100);
+  std::iota(offsets.begin(), offsets.end(), ChunkOffset{0});
+  expect_filtered(dictionary_segment, offsets, {5});
+
+  // reference segments are filtered by their positions
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1'000);
+  scan->execute();
+  expect_filtered(*scan->get_output()->get_chunk(ChunkID{4}).get_segment(ColumnID{0}), {0, 98, 99}, {99});
+}
+
+}  // namespace opossum
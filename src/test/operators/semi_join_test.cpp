@@ -0,0 +1,102 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/semi_join.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsSemiJoinTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    _table_wrapper_left->execute();
+
+    auto right_table = load_table("src/test/tables/join_right.tbl", 2);
+    right_table->compress_chunk(ChunkID{0});
+    _table_wrapper_right = std::make_shared<TableWrapper>(right_table);
+    _table_wrapper_right->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  // returns a table with the given rows of join_left.tbl
+  static std::shared_ptr<Table> _left_rows(const std::vector<std::pair<int32_t, std::string>>& rows) {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (const auto& [a, b] : rows) table->append({a, b});
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsSemiJoinTest, SemiAndAntiJoin) {
+  const auto expected_semi = _left_rows({{2, "two"}, {2, "two_again"}, {3, "three"}, {7, "seven"}});
+  const auto expected_anti = _left_rows({{1, "one"}, {5, "five"}});
+
+  for (const auto worker_count : {0u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+
+    // every left row is returned once, even though 3 has two partners
+    auto semi_join = std::make_shared<SemiJoin>(_table_wrapper_left, _table_wrapper_right,
+                                                std::make_pair(ColumnID{0}, ColumnID{0}));
+    semi_join->execute();
+    EXPECT_TABLE_EQ(semi_join->get_output(), expected_semi, true);
+
+    auto anti_join = std::make_shared<SemiJoin>(_table_wrapper_left, _table_wrapper_right,
+                                                std::make_pair(ColumnID{0}, ColumnID{0}), SemiJoinMode::Anti);
+    anti_join->execute();
+    EXPECT_TABLE_EQ(anti_join->get_output(), expected_anti, true);
+  }
+}
+
+TEST_F(OperatorsSemiJoinTest, ReferenceInputs) {
+  auto left_scan = std::make_shared<TableScan>(_table_wrapper_left, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  left_scan->execute();
+  auto right_scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{1}, ScanType::OpLessThan, 7.0f);
+  right_scan->execute();
+
+  auto semi_join = std::make_shared<SemiJoin>(left_scan, right_scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+  semi_join->execute();
+  EXPECT_TABLE_EQ(semi_join->get_output(), _left_rows({{3, "three"}}), true);
+
+  auto anti_join =
+      std::make_shared<SemiJoin>(left_scan, right_scan, std::make_pair(ColumnID{0}, ColumnID{0}), SemiJoinMode::Anti);
+  anti_join->execute();
+  EXPECT_TABLE_EQ(anti_join->get_output(), _left_rows({{5, "five"}, {7, "seven"}}), true);
+}
+
+TEST_F(OperatorsSemiJoinTest, EmptyResult) {
+  auto empty_scan = std::make_shared<TableScan>(_table_wrapper_right, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  empty_scan->execute();
+
+  auto semi_join =
+      std::make_shared<SemiJoin>(_table_wrapper_left, empty_scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+  semi_join->execute();
+  EXPECT_EQ(semi_join->get_output()->row_count(), 0u);
+  EXPECT_EQ(semi_join->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(semi_join->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsSemiJoinTest, DifferentTypes) {
+  auto semi_join = std::make_shared<SemiJoin>(_table_wrapper_left, _table_wrapper_right,
+                                              std::make_pair(ColumnID{0}, ColumnID{1}));
+  EXPECT_THROW(semi_join->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    // 1000 rows with many duplicates, negative numbers, and both 0.0 and -0.0 in chunks of 100 rows
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "long");
+    table->add_column("c", "float");
+    table->add_column("d", "double");
+    table->add_column("e", "string");
+
+    auto random_engine = std::mt19937{42};
+    for (auto row = 0; row < 1'000; ++row) {
+      const auto random_value = static_cast<int32_t>(random_engine() % 201) - 100;
+      const auto sign = row % 3 == 0 ? -1.0f : 1.0f;
+      table->append({random_value / 2, int64_t{random_value} * 100'000'000'000, sign * (random_value % 5) * 0.5f,
+                     random_value * 1e100, "value" + std::to_string(random_value % 37)});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{9}; chunk_id += 2) {
+      table->compress_chunk(chunk_id);
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  using Rows = std::vector<std::vector<AllTypeVariant>>;
+
+  // returns the rows of the table in order
+  static Rows _rows(const Table& table) {
+    PerformanceWarningDisabler pwd;
+    auto rows = Rows{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        auto& row = rows.emplace_back();
+        for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+      }
+    }
+    return rows;
+  }
+
+  // returns the rows of the table, stable sorted by the given column
+  static Rows _expected_rows(const Table& table, const ColumnID column_id, const OrderByMode order_by_mode) {
+    auto rows = _rows(table);
+    std::stable_sort(rows.begin(), rows.end(), [&](const auto& lhs, const auto& rhs) {
+      if (order_by_mode == OrderByMode::Descending) return rhs[column_id] < lhs[column_id];
+      return lhs[column_id] < rhs[column_id];
+    });
+    return rows;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsSortTest, AllTypes) {
+  const auto& input_table = *_table_wrapper->get_output();
+
+  for (const auto worker_count : {0u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    for (auto column_id = ColumnID{0}; column_id < input_table.column_count(); ++column_id) {
+      for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+        auto sort = std::make_shared<Sort>(_table_wrapper, column_id, order_by_mode);
+        sort->execute();
+        EXPECT_EQ(_rows(*sort->get_output()), _expected_rows(input_table, column_id, order_by_mode))
+            << "column " << column_id;
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsSortTest, OutputChunks) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0});
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(output.chunk_size(), 100u);
+  ASSERT_EQ(output.chunk_count(), 10u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output.get_chunk(chunk_id).size(), 100u);
+  }
+}
+
+TEST_F(OperatorsSortTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, -20);
+  scan->execute();
+
+  for (const auto& column_id : {ColumnID{1}, ColumnID{4}}) {
+    auto sort = std::make_shared<Sort>(scan, column_id, OrderByMode::Descending);
+    sort->execute();
+    EXPECT_EQ(_rows(*sort->get_output()),
+              _expected_rows(*scan->get_output(), column_id, OrderByMode::Descending));
+  }
+}
+
+TEST_F(OperatorsSortTest, SingleDictionarySegment) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("row", "int");
+  table->add_column("value", "string");
+  for (auto row = 0; row < 150; ++row) table->append({row, "value" + std::to_string((row * 7) % 23)});
+  table->compress_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // the scan output only references the dictionary encoded first chunk, so its value ids are sorted
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 80);
+  scan->execute();
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    auto sort = std::make_shared<Sort>(scan, ColumnID{1}, order_by_mode);
+    sort->execute();
+    EXPECT_EQ(_rows(*sort->get_output()), _expected_rows(*scan->get_output(), ColumnID{1}, order_by_mode));
+  }
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  // sorting by the less significant column first results in a lexicographic order, as the sort is stable
+  auto sort_e = std::make_shared<Sort>(_table_wrapper, ColumnID{4});
+  sort_e->execute();
+  auto sort_a = std::make_shared<Sort>(sort_e, ColumnID{0}, OrderByMode::Descending);
+  sort_a->execute();
+
+  const auto rows = _rows(*sort_a->get_output());
+  ASSERT_EQ(rows.size(), 1'000u);
+  for (auto row = size_t{1}; row < rows.size(); ++row) {
+    ASSERT_FALSE(rows[row - 1][0] < rows[row][0]);
+    if (rows[row - 1][0] == rows[row][0]) ASSERT_FALSE(rows[row][4] < rows[row - 1][4]);
+  }
+}
+
+TEST_F(OperatorsSortTest, ParallelRadixSort) {
+  // enough rows for the radix sort to use multiple tasks
+  WorkerPool::get().set_worker_count(4);
+  auto table = std::make_shared<Table>(10'000);
+  table->add_column("value", "long");
+  auto random_engine = std::mt19937_64{42};
+  for (auto row = 0; row < 150'000; ++row) table->append({static_cast<int64_t>(random_engine())});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+  sort->execute();
+  EXPECT_EQ(_rows(*sort->get_output()), _expected_rows(*table, ColumnID{0}, OrderByMode::Ascending));
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1'000);
+  scan->execute();
+  auto sort = std::make_shared<Sort>(scan, ColumnID{4});
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.column_count(), 5u);
+  EXPECT_EQ(output.chunk_count(), 1u);
+}
+
+}  // namespace opossum
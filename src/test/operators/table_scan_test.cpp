@@ -13,10 +13,12 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/load_table.hpp"
+#include "utils/performance_warning.hpp"
 
 namespace opossum {
 
@@ -75,6 +77,7 @@ class OperatorsTableScanTest : public BaseTest {
 
   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
                         std::vector<AllTypeVariant> expected) {
+    PerformanceWarningDisabler pwd;
     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
       const auto& chunk = table->get_chunk(chunk_id);
 
@@ -267,4 +270,113 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, ParallelScanKeepsChunkOrder) {
+  const auto previous_worker_count = WorkerPool::get().worker_count();
+
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (int i = 0; i < 1000; ++i) table->append({i % 7});
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count() - 1; chunk_id += 2) table->compress_chunk(chunk_id);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto worker_count : {0u, 1u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    ASSERT_EQ(output->row_count(), 143u);
+
+    // the i-th match is row i * 7 + 3
+    auto index = uint32_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto segment =
+          std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id).get_segment(ColumnID{0}));
+      for (const auto& row_id : *segment->pos_list()) {
+        const auto row = index * 7 + 3;
+        ASSERT_EQ(row_id, (RowID{ChunkID{row / 10}, row % 10}));
+        ++index;
+      }
+    }
+  }
+
+  WorkerPool::get().set_worker_count(previous_worker_count);
+}
+
+TEST_F(OperatorsTableScanTest, OutputMirrorsInputChunks) {
+  // values 0 to 24 in chunks of five rows, the first two chunks are dictionary encoded
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpNotEquals, 12);
+  scan_1->execute();
+
+  // chunk 1 (values 10 to 18) has no match
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpLessThan, 8);
+  scan_2->execute();
+  auto scan_3 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpNotEquals, 14);
+  scan_3->execute();
+
+  EXPECT_EQ(scan_1->get_output()->chunk_count(), 3u);
+  EXPECT_EQ(scan_2->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan_3->get_output()->chunk_count(), 3u);
+
+  for (const auto& scan : {scan_1, scan_2, scan_3}) {
+    const auto output = scan->get_output();
+    for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto segment =
+          std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id).get_segment(ColumnID{1}));
+      ASSERT_NE(segment, nullptr);
+      EXPECT_EQ(segment->referenced_table(), _table_wrapper_even_dict->get_output());
+
+      const auto& pos_list = *segment->pos_list();
+      EXPECT_TRUE(pos_list.references_single_chunk());
+      for (const auto& row_id : pos_list) EXPECT_EQ(row_id.chunk_id, pos_list.front().chunk_id);
+    }
+  }
+
+  ASSERT_COLUMN_EQ(scan_3->get_output(), ColumnID{0}, {0, 2, 4, 6, 8, 10, 16, 18, 20, 22, 24});
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithRuntimeFilter) {
+  // a fact table with 1000 rows referencing 100 dimension rows, and a scan that selects five of the dimension rows
+  auto fact_table = std::make_shared<Table>(100);
+  fact_table->add_column("value", "int");
+  fact_table->add_column("dimension_id", "int");
+  for (auto row = 0; row < 1'000; ++row) fact_table->append({row, (row * 37) % 100});
+  fact_table->compress_chunk(ChunkID{0});
+  auto fact_wrapper = std::make_shared<TableWrapper>(fact_table);
+  fact_wrapper->execute();
+
+  auto dimension_table = std::make_shared<Table>(10);
+  dimension_table->add_column("id", "int");
+  for (auto id = 0; id < 100; ++id) dimension_table->append({id});
+  auto dimension_wrapper = std::make_shared<TableWrapper>(dimension_table);
+  dimension_wrapper->execute();
+  auto dimension_scan = std::make_shared<TableScan>(dimension_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  dimension_scan->execute();
+
+  // the filter applies to data and reference inputs
+  auto data_scan = std::make_shared<TableScan>(fact_wrapper, ColumnID{0}, ScanType::OpLessThan, 900);
+  auto reference_scan = std::make_shared<TableScan>(data_scan, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  for (const auto& scan : {data_scan, reference_scan}) {
+    scan->set_runtime_filter(dimension_scan, ColumnID{0}, ColumnID{1});
+    EXPECT_EQ(scan->input_right(), dimension_scan);
+    scan->execute();
+
+    // 45 rows find a partner, only a few false positives may remain
+    PerformanceWarningDisabler pwd;
+    auto partner_count = size_t{0};
+    const auto& output = *scan->get_output();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+      const auto& chunk = output.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        EXPECT_LT(type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]), 900);
+        if (type_cast<int32_t>((*chunk.get_segment(ColumnID{1}))[chunk_offset]) < 5) ++partner_count;
+      }
+    }
+    EXPECT_EQ(partner_count, 45u);
+    EXPECT_LT(output.row_count(), 60u);
+  }
+}
+
 }  // namespace opossum
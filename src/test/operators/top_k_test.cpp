@@ -0,0 +1,93 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    // values that grow with the row, so that most dictionary encoded chunks can be skipped, plus some noise
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "double");
+    table->add_column("c", "string");
+    auto random_engine = std::mt19937{42};
+    for (auto row = 0; row < 2'000; ++row) {
+      const auto noise = static_cast<int32_t>(random_engine() % 50);
+      table->append({row / 10 + noise, (row % 7) * 0.25, "value" + std::to_string(noise % 13)});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{19}; ++chunk_id) {
+      if (chunk_id % 4 != 3) table->compress_chunk(chunk_id);
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  // checks that TopK returns the same rows as a Sort followed by a Limit
+  void _expect_top_k(const std::shared_ptr<const AbstractOperator>& input, const ColumnID column_id, const size_t k,
+                     const OrderByMode order_by_mode) {
+    auto top_k = std::make_shared<TopK>(input, column_id, k, order_by_mode);
+    top_k->execute();
+    auto sort = std::make_shared<Sort>(input, column_id, order_by_mode);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, k);
+    limit->execute();
+
+    EXPECT_TABLE_EQ(top_k->get_output(), limit->get_output(), true);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  size_t _previous_worker_count;
+};
+
+TEST_F(OperatorsTopKTest, MatchesSortAndLimit) {
+  for (const auto worker_count : {0u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    for (auto column_id = ColumnID{0}; column_id < 3; ++column_id) {
+      for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+        for (const auto k : {size_t{1}, size_t{17}, size_t{150}, size_t{5'000}}) {
+          _expect_top_k(_table_wrapper, column_id, k, order_by_mode);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpNotEquals, "value3");
+  scan->execute();
+
+  _expect_top_k(scan, ColumnID{0}, 42, OrderByMode::Descending);
+  _expect_top_k(scan, ColumnID{2}, 42, OrderByMode::Ascending);
+}
+
+TEST_F(OperatorsTopKTest, NoRows) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, ColumnID{0}, 0);
+  top_k->execute();
+
+  const auto& output = *top_k->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.chunk_count(), 1u);
+  EXPECT_EQ(output.column_count(), 3u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class OperatorsUnionPositionsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 95; ++row) table->append({row, "value" + std::to_string(row % 4)});
+    table->compress_chunk(ChunkID{2});
+    table->compress_chunk(ChunkID{5});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableScan> _scan(const std::shared_ptr<const AbstractOperator>& input, const ColumnID column_id,
+                                   const ScanType scan_type, const AllTypeVariant& value) {
+    auto scan = std::make_shared<TableScan>(input, column_id, scan_type, value);
+    scan->execute();
+    return scan;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUnionPositionsTest, Disjunction) {
+  // a < 12 OR b = 'value1', the rows of both scans overlap
+  auto less_than = _scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 12);
+  auto equals = _scan(_table_wrapper, ColumnID{1}, ScanType::OpEquals, "value1");
+  auto union_positions = std::make_shared<UnionPositions>(less_than, equals);
+  union_positions->execute();
+
+  auto expected_values = std::vector<int32_t>{};
+  for (auto value = 0; value < 95; ++value) {
+    if (value < 12 || value % 4 == 1) expected_values.emplace_back(value);
+  }
+  const auto& output = *union_positions->get_output();
+  EXPECT_EQ(_column_values<int32_t>(output, ColumnID{0}), expected_values);
+  EXPECT_EQ(output.column_names(), _table_wrapper->get_output()->column_names());
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ(type_cast<std::string>((*output.get_chunk(ChunkID{2}).get_segment(ColumnID{1}))[1]), "value1");
+}
+
+TEST_F(OperatorsUnionPositionsTest, ReferenceInputs) {
+  // the second input references the rows in descending order with a PosList
+  auto scan = _scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 30);
+  auto left = _scan(scan, ColumnID{0}, ScanType::OpLessThan, 40);
+  auto sort = std::make_shared<Sort>(_scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 85), ColumnID{0},
+                                     OrderByMode::Descending);
+  sort->execute();
+
+  auto union_positions = std::make_shared<UnionPositions>(left, sort);
+  union_positions->execute();
+
+  auto expected_values = std::vector<int32_t>{};
+  for (auto value = 30; value < 40; ++value) expected_values.emplace_back(value);
+  for (auto value = 86; value < 95; ++value) expected_values.emplace_back(value);
+  EXPECT_EQ(_column_values<int32_t>(*union_positions->get_output(), ColumnID{0}), expected_values);
+}
+
+TEST_F(OperatorsUnionPositionsTest, EmptyInputs) {
+  auto empty_scan = _scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 0);
+
+  auto union_positions =
+      std::make_shared<UnionPositions>(empty_scan, _scan(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 42));
+  union_positions->execute();
+  EXPECT_EQ(_column_values<int32_t>(*union_positions->get_output(), ColumnID{0}), std::vector<int32_t>{42});
+
+  auto empty_union = std::make_shared<UnionPositions>(empty_scan, empty_scan);
+  empty_union->execute();
+  EXPECT_EQ(empty_union->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_union->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(empty_union->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsUnionPositionsTest, DifferentTables) {
+  auto other_table = std::make_shared<Table>(10);
+  other_table->add_column("a", "int");
+  other_table->add_column("b", "string");
+  other_table->append({1, "value1"});
+  auto other_wrapper = std::make_shared<TableWrapper>(other_table);
+  other_wrapper->execute();
+
+  auto union_positions = std::make_shared<UnionPositions>(_scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5),
+                                                          _scan(other_wrapper, ColumnID{0}, ScanType::OpLessThan, 5));
+  EXPECT_THROW(union_positions->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,140 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/materialize.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/pipeline.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+class PipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+
+    // 100 rows in chunks of 10 rows, every other chunk is dictionary encoded
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "double");
+    table->add_column("c", "string");
+    for (auto row = 0; row < 100; ++row) table->append({row, row * 0.5, "value" + std::to_string(row % 7)});
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) table->compress_chunk(chunk_id);
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  size_t _previous_worker_count;
+};
+
+TEST_F(PipelineTest, FusesScansAndProjection) {
+  const auto make_plan = [&]() {
+    auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 15);
+    auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpLessThan, 40.0);
+    auto scan_c = std::make_shared<TableScan>(scan_b, ColumnID{2}, ScanType::OpNotEquals, "value3");
+    const auto expressions =
+        std::vector<ExpressionPointer>{column_(ColumnID{2}), add_(column_(ColumnID{0}), column_(ColumnID{1})),
+                                       greater_than_(column_(ColumnID{0}), 50)};
+    auto projection = std::make_shared<Projection>(scan_c, expressions);
+    return std::make_pair(scan_a, projection);
+  };
+
+  const auto [unfused_scan, unfused_root] = make_plan();  // NOLINT
+  Scheduler::execute(unfused_root);
+  ASSERT_TRUE(unfused_scan->executed());
+
+  for (const auto worker_count : {0u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+    const auto [scan, root] = make_plan();  // NOLINT
+    Scheduler::execute(root, ExecutionMode::Pipelined);
+
+    // only the output of the last operator of the pipeline is materialized
+    EXPECT_FALSE(scan->executed());
+    ASSERT_TRUE(root->executed());
+    EXPECT_TABLE_EQ(root->get_output(), unfused_root->get_output(), true);
+    EXPECT_EQ(root->get_output()->chunk_count(), unfused_root->get_output()->chunk_count());
+  }
+}
+
+TEST_F(PipelineTest, ReferencesIntermediateData) {
+  WorkerPool::get().set_worker_count(4);
+
+  // the second scan references the values materialized in the pipeline
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpEquals, "value2");
+  auto materialize = std::make_shared<Materialize>(scan_a, MaterializeEncoding::Dictionary);
+  auto scan_b = std::make_shared<TableScan>(materialize, ColumnID{0}, ScanType::OpGreaterThan, 50);
+  Pipeline::execute({scan_a.get(), materialize.get(), scan_b.get()});
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", "int");
+  expected_result->add_column("b", "double");
+  expected_result->add_column("c", "string");
+  for (const auto& row : {51, 58, 65, 72, 79, 86, 93}) expected_result->append({row, row * 0.5, "value2"});
+  EXPECT_TABLE_EQ(scan_b->get_output(), expected_result, true);
+}
+
+TEST_F(PipelineTest, EmptyResult) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto projection =
+      std::make_shared<Projection>(scan_b, std::vector<ExpressionPointer>{mul_(column_(ColumnID{1}), 2.0)});
+  Pipeline::execute({scan_a.get(), scan_b.get(), projection.get()});
+
+  const auto& output = *projection->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.column_count(), 1u);
+  ASSERT_EQ(output.chunk_count(), 1u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 1u);
+
+  auto materialize = std::make_shared<Materialize>(scan_b);
+  Pipeline::execute({scan_a.get(), scan_b.get(), materialize.get()});
+  EXPECT_EQ(materialize->get_output()->row_count(), 0u);
+  EXPECT_EQ(materialize->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+TEST_F(PipelineTest, BreaksAtJoinsAndSharedInputs) {
+  WorkerPool::get().set_worker_count(4);
+
+  // the join consumes the (materialized) outputs of two pipelines, the shared scan is consumed by both of them
+  auto shared_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 60);
+  auto left_scan = std::make_shared<TableScan>(shared_scan, ColumnID{0}, ScanType::OpGreaterThan, 20);
+  auto right_scan = std::make_shared<TableScan>(shared_scan, ColumnID{2}, ScanType::OpEquals, "value1");
+  auto materialize = std::make_shared<Materialize>(right_scan);
+  auto join = std::make_shared<JoinHash>(left_scan, materialize, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  auto sort = std::make_shared<Sort>(join, ColumnID{0});
+  Scheduler::execute(sort, ExecutionMode::Pipelined);
+
+  EXPECT_TRUE(shared_scan->executed());
+  EXPECT_TRUE(left_scan->executed());
+  EXPECT_FALSE(right_scan->executed());
+  EXPECT_TRUE(materialize->executed());
+  EXPECT_TRUE(join->executed());
+
+  // the rows 22, 29, ..., 57 are in both scans
+  const auto& output = *sort->get_output();
+  ASSERT_EQ(output.row_count(), 6u);
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->operator[](0), AllTypeVariant{22});
+}
+
+}  // namespace opossum
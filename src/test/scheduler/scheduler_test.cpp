@@ -0,0 +1,220 @@
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/abstract_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/semi_join.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// passes on its input, counts how often it is executed, and can wait for another operator to start
+class TestOperator : public AbstractOperator {
+ public:
+  explicit TestOperator(const std::shared_ptr<const AbstractOperator> in,
+                        const std::shared_ptr<const TestOperator>& waits_for = nullptr)
+      : AbstractOperator(in), _waits_for(waits_for) {}
+
+  std::atomic<size_t> execution_count{0};
+  bool throws = false;
+
+  // whether the other operator started while this one was running
+  bool saw_concurrent_start = false;
+
+  const std::string name() const override { return "TestOperator"; }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    ++execution_count;
+    if (throws) throw std::logic_error("failed");
+
+    if (_waits_for) {
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+      while (!_waits_for->execution_count && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+      saw_concurrent_start = _waits_for->execution_count > 0;
+    }
+
+    return _input_table_left();
+  }
+
+  const std::shared_ptr<const TestOperator> _waits_for;
+};
+
+}  // namespace
+
+class SchedulerTest : public BaseTest {
+ protected:
+  void SetUp() override { _previous_worker_count = WorkerPool::get().worker_count(); }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  size_t _previous_worker_count;
+};
+
+TEST_F(SchedulerTest, ExecutesOperatorTree) {
+  for (const auto worker_count : {0u, 1u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+
+    // none of the operators has been executed before
+    auto left = std::make_shared<TableWrapper>(load_table("src/test/tables/join_left.tbl", 2));
+    auto right = std::make_shared<TableWrapper>(load_table("src/test/tables/join_right.tbl", 2));
+    auto scan = std::make_shared<TableScan>(right, ColumnID{1}, ScanType::OpLessThan, 8.0f);
+    auto join = std::make_shared<JoinHash>(left, scan, std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpEquals);
+    auto sort = std::make_shared<Sort>(join, ColumnID{3});
+
+    Scheduler::execute(sort);
+
+    for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{left, right, scan, join, sort}) {
+      EXPECT_NE(op->get_output(), nullptr);
+    }
+    EXPECT_EQ(sort->get_output()->row_count(), 5u);
+  }
+}
+
+TEST_F(SchedulerTest, SharedInputsAreExecutedOnce) {
+  WorkerPool::get().set_worker_count(4);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  auto shared = std::make_shared<TestOperator>(table_wrapper);
+  auto self_join = std::make_shared<JoinHash>(shared, shared, std::make_pair(ColumnID{0}, ColumnID{0}));
+  auto scan_1 = std::make_shared<TableScan>(shared, ColumnID{0}, ScanType::OpLessThan, 1'000);
+  auto scan_2 = std::make_shared<TableScan>(shared, ColumnID{0}, ScanType::OpGreaterThan, 10'000);
+  auto union_positions = std::make_shared<UnionPositions>(scan_1, scan_2);
+  auto join = std::make_shared<SemiJoin>(self_join, union_positions, std::make_pair(ColumnID{0}, ColumnID{0}));
+
+  Scheduler::execute(join);
+  EXPECT_EQ(shared->execution_count, 1u);
+  EXPECT_GT(join->get_output()->row_count(), 0u);
+
+  // executed operators are not executed again
+  Scheduler::execute(join);
+  EXPECT_EQ(shared->execution_count, 1u);
+  EXPECT_GT(join->get_output()->row_count(), 0u);
+}
+
+TEST_F(SchedulerTest, IndependentOperatorsRunConcurrently) {
+  WorkerPool::get().set_worker_count(2);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  // both inputs of the join wait for each other to start, which only works if they run at the same time
+  auto left = std::make_shared<TestOperator>(table_wrapper);
+  auto right = std::make_shared<TestOperator>(table_wrapper, left);
+  auto left_waiting = std::make_shared<TestOperator>(left);
+  auto join = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}));
+
+  Scheduler::execute(join);
+  EXPECT_TRUE(right->saw_concurrent_start);
+  EXPECT_EQ(left_waiting->execution_count, 0u);
+}
+
+TEST_F(SchedulerTest, RethrowsExceptions) {
+  WorkerPool::get().set_worker_count(2);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  auto failing = std::make_shared<TestOperator>(table_wrapper);
+  failing->throws = true;
+  auto consumer = std::make_shared<TestOperator>(failing);
+
+  EXPECT_THROW(Scheduler::execute(consumer), std::logic_error);
+  EXPECT_EQ(consumer->execution_count, 0u);
+  EXPECT_FALSE(consumer->executed());
+  EXPECT_THROW(consumer->get_output(), std::logic_error);
+}
+
+TEST_F(SchedulerTest, ExecutesAsynchronously) {
+  WorkerPool::get().set_worker_count(2);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  // the asynchronously executed operator waits for one that the calling thread executes after execute_async returns
+  auto other = std::make_shared<TestOperator>(table_wrapper);
+  auto waiting = std::make_shared<TestOperator>(table_wrapper, other);
+  auto scan = std::make_shared<TableScan>(waiting, ColumnID{0}, ScanType::OpLessThan, 1'000);
+  auto future = scan->execute_async();
+  other->execute();
+
+  future.wait();
+  EXPECT_TRUE(waiting->saw_concurrent_start);
+  EXPECT_TRUE(scan->executed());
+  EXPECT_EQ(scan->get_output()->row_count(), 1u);
+  EXPECT_THROW(scan->execute_async(), std::logic_error);
+}
+
+TEST_F(SchedulerTest, AsynchronousExecutionKeepsOperatorAlive) {
+  WorkerPool::get().set_worker_count(2);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  // the operator is still running, waiting for the other one, when the last pointer to it is dropped
+  auto other = std::make_shared<TestOperator>(table_wrapper);
+  auto waiting = std::make_shared<TestOperator>(table_wrapper, other);
+  auto scan = std::make_shared<TableScan>(waiting, ColumnID{0}, ScanType::OpLessThan, 1'000);
+  auto future = scan->execute_async();
+  const auto weak_scan = std::weak_ptr<TableScan>{scan};
+  scan.reset();
+  EXPECT_FALSE(weak_scan.expired());
+  other->execute();
+
+  future.get();
+  EXPECT_TRUE(waiting->saw_concurrent_start);
+  EXPECT_TRUE(waiting->executed());
+}
+
+TEST_F(SchedulerTest, WorkersCanWaitForAsynchronousExecutions) {
+  WorkerPool::get().set_worker_count(1);
+
+  // the only worker waits for an operator whose task it queued itself, and this thread does not help
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 1'000);
+  auto row_count = std::promise<size_t>{};
+  auto row_count_future = row_count.get_future();
+  WorkerPool::get().schedule([&]() {
+    scan->execute_async();
+    row_count.set_value(scan->get_output()->row_count());
+  });
+
+  ASSERT_EQ(row_count_future.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+  EXPECT_EQ(row_count_future.get(), 1u);
+}
+
+TEST_F(SchedulerTest, AsynchronousExecutionRethrowsExceptions) {
+  for (const auto worker_count : {0u, 2u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    auto failing = std::make_shared<TestOperator>(table_wrapper);
+    failing->throws = true;
+    auto consumer = std::make_shared<TestOperator>(failing);
+
+    // get_output waits for the execution, so it rethrows the exception as well
+    auto future = consumer->execute_async();
+    EXPECT_THROW(consumer->get_output(), std::logic_error);
+    EXPECT_THROW(future.get(), std::logic_error);
+    EXPECT_EQ(consumer->execution_count, 0u);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/worker_pool.hpp"
+
+namespace opossum {
+
+class WorkerPoolTest : public BaseTest {
+ protected:
+  void SetUp() override { _previous_worker_count = WorkerPool::get().worker_count(); }
+
+  void TearDown() override { WorkerPool::get().set_worker_count(_previous_worker_count); }
+
+  size_t _previous_worker_count;
+};
+
+TEST_F(WorkerPoolTest, SetWorkerCount) {
+  WorkerPool::get().set_worker_count(3);
+  EXPECT_EQ(WorkerPool::get().worker_count(), 3u);
+
+  WorkerPool::get().set_worker_count(0);
+  EXPECT_EQ(WorkerPool::get().worker_count(), 0u);
+}
+
+TEST_F(WorkerPoolTest, ExecutesAllTasks) {
+  for (const auto worker_count : {0u, 1u, 4u}) {
+    WorkerPool::get().set_worker_count(worker_count);
+
+    auto results = std::vector<int>(100, 0);
+    auto tasks = std::vector<std::function<void()>>{};
+    for (auto task_id = size_t{0}; task_id < results.size(); ++task_id) {
+      tasks.emplace_back([&, task_id]() { results[task_id] = static_cast<int>(task_id) * 2; });
+    }
+    WorkerPool::get().execute_and_wait(tasks);
+
+    for (auto task_id = size_t{0}; task_id < results.size(); ++task_id) {
+      EXPECT_EQ(results[task_id], static_cast<int>(task_id) * 2);
+    }
+  }
+}
+
+TEST_F(WorkerPoolTest, NestedTasks) {
+  // tasks that wait for their own sub-tasks must not block the pool, even if there are fewer workers than tasks
+  WorkerPool::get().set_worker_count(2);
+
+  auto counter = std::atomic<size_t>{0};
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto task_id = 0; task_id < 8; ++task_id) {
+    tasks.emplace_back([&]() {
+      auto sub_tasks = std::vector<std::function<void()>>(8, [&]() { ++counter; });
+      WorkerPool::get().execute_and_wait(sub_tasks);
+    });
+  }
+  WorkerPool::get().execute_and_wait(tasks);
+
+  EXPECT_EQ(counter, 64u);
+}
+
+TEST_F(WorkerPoolTest, RethrowsExceptions) {
+  WorkerPool::get().set_worker_count(2);
+
+  auto tasks = std::vector<std::function<void()>>{[]() {}, []() { throw std::logic_error("failed"); }, []() {}};
+  EXPECT_THROW(WorkerPool::get().execute_and_wait(tasks), std::logic_error);
+}
+
+TEST_F(WorkerPoolTest, IdleWorkersStealTasks) {
+  WorkerPool::get().set_worker_count(4);
+
+  // all sub-tasks are queued by the worker that executes the outer task, the others have to steal them
+  auto thread_ids = std::vector<std::thread::id>(64);
+  auto outer_task = std::vector<std::function<void()>>{[&]() {
+    auto sub_tasks = std::vector<std::function<void()>>{};
+    for (auto task_id = size_t{0}; task_id < thread_ids.size(); ++task_id) {
+      sub_tasks.emplace_back([&, task_id]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        thread_ids[task_id] = std::this_thread::get_id();
+      });
+    }
+    WorkerPool::get().execute_and_wait(sub_tasks);
+  }};
+  WorkerPool::get().execute_and_wait(outer_task);
+
+  std::sort(thread_ids.begin(), thread_ids.end());
+  EXPECT_GT(std::unique(thread_ids.begin(), thread_ids.end()) - thread_ids.begin(), 1);
+}
+
+TEST_F(WorkerPoolTest, ScheduledTasks) {
+  // without workers, the calling thread executes the task right away
+  WorkerPool::get().set_worker_count(0);
+  auto executed = false;
+  WorkerPool::get().schedule([&]() { executed = true; });
+  EXPECT_TRUE(executed);
+
+  // otherwise, schedule returns while the task is still waiting
+  WorkerPool::get().set_worker_count(1);
+  auto started = std::atomic<bool>{false};
+  auto released = std::atomic<bool>{false};
+  auto finished = std::atomic<bool>{false};
+  WorkerPool::get().schedule([&]() {
+    started = true;
+    while (!released) std::this_thread::yield();
+    finished = true;
+  });
+  while (!started) std::this_thread::yield();
+  released = true;
+  while (!finished) std::this_thread::yield();
+
+  // exceptions of scheduled tasks are passed on through their futures and do not affect the pool
+  const auto failing_task = WorkerPool::get().schedule([]() { throw std::logic_error("failed"); });
+  EXPECT_THROW(failing_task->future().get(), std::logic_error);
+  auto counter = std::atomic<size_t>{0};
+  WorkerPool::get().execute_and_wait(std::vector<std::function<void()>>(4, [&]() { ++counter; }));
+  EXPECT_EQ(counter, 4u);
+}
+
+TEST_F(WorkerPoolTest, WaitingThreadsDoNotStartScheduledTasks) {
+  WorkerPool::get().set_worker_count(1);
+
+  // the scheduled tasks are left to the worker while this thread helps with the tasks it waits for
+  auto thread_ids = std::vector<std::thread::id>(8);
+  auto scheduled_tasks = std::vector<std::shared_ptr<ScheduledTask>>{};
+  for (auto task_id = size_t{0}; task_id < thread_ids.size(); ++task_id) {
+    scheduled_tasks.emplace_back(
+        WorkerPool::get().schedule([&, task_id]() { thread_ids[task_id] = std::this_thread::get_id(); }));
+  }
+  WorkerPool::get().execute_and_wait(std::vector<std::function<void()>>(8, []() {}));
+
+  for (const auto& scheduled_task : scheduled_tasks) scheduled_task->future().wait();
+  for (const auto& thread_id : thread_ids) EXPECT_NE(thread_id, std::this_thread::get_id());
+}
+
+TEST_F(WorkerPoolTest, WaitExecutesOnlyTheAwaitedTask) {
+  WorkerPool::get().set_worker_count(1);
+
+  // the only worker is busy until it is released
+  auto started = std::atomic<bool>{false};
+  auto released = std::atomic<bool>{false};
+  const auto blocking_task = WorkerPool::get().schedule([&]() {
+    started = true;
+    while (!released) std::this_thread::yield();
+  });
+  while (!started) std::this_thread::yield();
+
+  // waiting for the second task executes it on this thread, the first one is left to the worker
+  auto first_executed = std::atomic<bool>{false};
+  auto second_thread_id = std::thread::id{};
+  const auto first_task = WorkerPool::get().schedule([&]() { first_executed = true; });
+  const auto second_task = WorkerPool::get().schedule([&]() { second_thread_id = std::this_thread::get_id(); });
+  WorkerPool::get().wait(*second_task);
+  EXPECT_EQ(second_thread_id, std::this_thread::get_id());
+  EXPECT_FALSE(first_executed);
+
+  released = true;
+  WorkerPool::get().wait(*blocking_task);
+  WorkerPool::get().wait(*first_task);
+  EXPECT_TRUE(first_executed);
+}
+
+}  // namespace opossum
@@ -0,0 +1,117 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class ChunkPosListTest : public BaseTest {
+ protected:
+  std::vector<ChunkOffset> collect(const ChunkPosList& pos_list) {
+    auto offsets = std::vector<ChunkOffset>{};
+    pos_list.for_each([&](const size_t position, const ChunkOffset chunk_offset) {
+      EXPECT_EQ(position, offsets.size());
+      offsets.emplace_back(chunk_offset);
+    });
+    return offsets;
+  }
+};
+
+TEST_F(ChunkPosListTest, ChoosesRepresentationBySelectivity) {
+  const auto sparse = ChunkPosList::make(ChunkID{1}, 1000, {3, 500, 999});
+  EXPECT_EQ(sparse->representation(), ChunkPosList::Representation::Offsets);
+  EXPECT_EQ(sparse->size(), 3u);
+  EXPECT_EQ(sparse->chunk_id(), ChunkID{1});
+
+  auto offsets = std::vector<ChunkOffset>{};
+  for (auto offset = ChunkOffset{0}; offset < 1000; offset += 3) offsets.emplace_back(offset);
+  const auto dense = ChunkPosList::make(ChunkID{1}, 1000, offsets);
+  EXPECT_EQ(dense->representation(), ChunkPosList::Representation::Bitmap);
+  EXPECT_EQ(dense->size(), offsets.size());
+  EXPECT_LT(dense->estimate_memory_usage(), offsets.size() * sizeof(RowID));
+  EXPECT_EQ(collect(*dense), offsets);
+}
+
+TEST_F(ChunkPosListTest, AccessesBitmapPositions) {
+  auto offsets = std::vector<ChunkOffset>{};
+  for (auto offset = ChunkOffset{0}; offset < 5000; offset += 7) offsets.emplace_back(offset);
+  const auto pos_list = ChunkPosList::make(ChunkID{0}, 5000, offsets);
+  ASSERT_EQ(pos_list->representation(), ChunkPosList::Representation::Bitmap);
+
+  for (auto position = size_t{0}; position < offsets.size(); ++position) {
+    EXPECT_EQ((*pos_list)[position], offsets[position]);
+  }
+}
+
+TEST_F(ChunkPosListTest, SparseBitmapBecomesOffsets) {
+  auto bitmap = std::vector<uint64_t>(16, 0);
+  bitmap[2] = uint64_t{1} << 5;
+  const auto pos_list = ChunkPosList::make_from_bitmap(ChunkID{0}, 1000, bitmap);
+  EXPECT_EQ(pos_list->representation(), ChunkPosList::Representation::Offsets);
+  EXPECT_EQ(collect(*pos_list), std::vector<ChunkOffset>{133});
+}
+
+TEST_F(ChunkPosListTest, EntireChunk) {
+  const auto pos_list = ChunkPosList::make_entire_chunk(ChunkID{2}, 130);
+  EXPECT_EQ(pos_list->representation(), ChunkPosList::Representation::Bitmap);
+  EXPECT_EQ(pos_list->size(), 130u);
+  EXPECT_EQ(pos_list->chunk_id(), ChunkID{2});
+  EXPECT_EQ((*pos_list)[129], ChunkOffset{129});
+}
+
+TEST_F(ChunkPosListTest, IntersectsAndUnites) {
+  auto even = std::vector<ChunkOffset>{};
+  for (auto offset = ChunkOffset{0}; offset < 200; offset += 2) even.emplace_back(offset);
+  const auto dense = ChunkPosList::make(ChunkID{0}, 200, even);
+  const auto sparse = ChunkPosList::make(ChunkID{0}, 200, {1, 4, 7});
+  const auto other_sparse = ChunkPosList::make(ChunkID{0}, 200, {4, 9});
+
+  EXPECT_EQ(collect(*ChunkPosList::intersect(*dense, *sparse)), std::vector<ChunkOffset>({4}));
+  EXPECT_EQ(collect(*ChunkPosList::intersect(*sparse, *other_sparse)), std::vector<ChunkOffset>({4}));
+  EXPECT_EQ(collect(*ChunkPosList::intersect(*dense, *dense)), even);
+  EXPECT_EQ(collect(*ChunkPosList::unite(*sparse, *other_sparse)), std::vector<ChunkOffset>({1, 4, 7, 9}));
+
+  const auto united = ChunkPosList::unite(*dense, *sparse);
+  EXPECT_EQ(united->size(), even.size() + 2);
+  EXPECT_EQ((*united)[1], 1u);
+  EXPECT_EQ((*united)[5], 7u);
+
+  const auto other_chunk = ChunkPosList::make(ChunkID{1}, 200, {1});
+  EXPECT_THROW(ChunkPosList::intersect(*sparse, *other_chunk), std::logic_error);
+}
+
+TEST_F(ChunkPosListTest, BacksReferenceSegment) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 250; ++row) table->append({row});
+  table->compress_chunk(ChunkID{1});
+
+  auto offsets = std::vector<ChunkOffset>{};
+  for (auto offset = ChunkOffset{0}; offset < 100; offset += 2) offsets.emplace_back(offset);
+  const auto segment = ReferenceSegment(table, ColumnID{0}, ChunkPosList::make(ChunkID{1}, 100, offsets));
+  ASSERT_EQ(segment.chunk_pos_list()->representation(), ChunkPosList::Representation::Bitmap);
+
+  EXPECT_EQ(segment.size(), 50u);
+  PerformanceWarningDisabler pwd;
+  EXPECT_EQ(segment[3], AllTypeVariant{106});
+
+  auto values = std::vector<int32_t>(segment.size());
+  resolve_reference_segment<int32_t>(segment, [&](const size_t position, const int32_t value) {
+    values[position] = value;
+  });
+  EXPECT_EQ(values[49], 198);
+
+  const auto pos_list = segment.pos_list();
+  EXPECT_TRUE(pos_list->references_single_chunk());
+  EXPECT_EQ((*pos_list)[49], (RowID{ChunkID{1}, 98}));
+}
+
+}  // namespace opossum
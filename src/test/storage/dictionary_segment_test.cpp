@@ -7,6 +7,7 @@
 #include "../../lib/storage/base_segment.hpp"
 #include "../../lib/storage/dictionary_segment.hpp"
 #include "../../lib/storage/value_segment.hpp"
+#include "../../lib/utils/performance_warning.hpp"
 
 class StorageDictionarySegmentTest : public ::testing::Test {
  protected:
@@ -98,6 +99,7 @@ TEST_F(StorageDictionarySegmentTest, ValueRetrieval) {
   EXPECT_EQ(dc_int->value_by_value_id(opossum::ValueID{56}), 56);
   EXPECT_EQ(dc_int->value_by_value_id(opossum::ValueID{99}), 99);
 
+  opossum::PerformanceWarningDisabler pwd;
   EXPECT_EQ((*dc_int)[23], opossum::AllTypeVariant{23});
   EXPECT_EQ((*dc_int)[123], opossum::AllTypeVariant{23});
   EXPECT_EQ((*dc_int)[223], opossum::AllTypeVariant{23});
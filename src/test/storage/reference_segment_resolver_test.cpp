@@ -0,0 +1,84 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment_resolver.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ReferenceSegmentResolverTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // three chunks of three rows, the second one is dictionary encoded
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto row = 0; row < 9; ++row) _table->append({row * 10, std::to_string(row)});
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  template <typename T>
+  std::vector<T> resolve(const ColumnID column_id, const std::shared_ptr<PosList>& pos_list) {
+    const auto segment = ReferenceSegment(_table, column_id, pos_list);
+    auto values = std::vector<T>(pos_list->size());
+    auto visited_positions = size_t{0};
+    resolve_reference_segment<T>(segment, [&](const size_t position, const T& value) {
+      values[position] = value;
+      ++visited_positions;
+    });
+    EXPECT_EQ(visited_positions, pos_list->size());
+    return values;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ReferenceSegmentResolverTest, SingleChunk) {
+  auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>({RowID{ChunkID{1}, 2}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}}));
+  pos_list->guarantee_single_chunk();
+
+  EXPECT_EQ(resolve<int32_t>(ColumnID{0}, pos_list), (std::vector<int32_t>{50, 30, 50}));
+  EXPECT_EQ(resolve<std::string>(ColumnID{1}, pos_list), (std::vector<std::string>{"5", "3", "5"}));
+}
+
+TEST_F(ReferenceSegmentResolverTest, ClusteredPositions) {
+  // long runs of positions per chunk
+  auto pos_list = std::make_shared<PosList>();
+  auto expected_values = std::vector<int32_t>{};
+  for (auto row = 0; row < 9; ++row) {
+    for (auto repetition = 0; repetition < 20; ++repetition) {
+      pos_list->emplace_back(RowID{ChunkID{static_cast<uint32_t>(row / 3)}, static_cast<ChunkOffset>(row % 3)});
+      expected_values.emplace_back(row * 10);
+    }
+  }
+
+  EXPECT_EQ(resolve<int32_t>(ColumnID{0}, pos_list), expected_values);
+}
+
+TEST_F(ReferenceSegmentResolverTest, UnclusteredPositions) {
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{2}, 1}, RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{2}, 0}}));
+
+  EXPECT_EQ(resolve<int32_t>(ColumnID{0}, pos_list), (std::vector<int32_t>{70, 0, 40, 20, 60}));
+  EXPECT_EQ(resolve<std::string>(ColumnID{1}, pos_list), (std::vector<std::string>{"7", "0", "4", "2", "6"}));
+}
+
+TEST_F(ReferenceSegmentResolverTest, ResolveSegmentValues) {
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    auto values = std::vector<int32_t>{};
+    resolve_segment_values<int32_t>(*_table->get_chunk(chunk_id).get_segment(ColumnID{0}),
+                                    [&](const size_t position, const int32_t value) { values.emplace_back(value); });
+
+    const auto first_value = static_cast<int32_t>(chunk_id) * 30;
+    EXPECT_EQ(values, (std::vector<int32_t>{first_value, first_value + 10, first_value + 20}));
+  }
+}
+
+}  // namespace opossum
@@ -16,6 +16,7 @@
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/performance_warning.hpp"
 
 namespace opossum {
 
@@ -63,6 +64,7 @@ TEST_F(ReferenceSegmentTest, RetrievesValues) {
 
   auto& column = *(_test_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
 
+  PerformanceWarningDisabler pwd;
   EXPECT_EQ(reference_segment[0], column[0]);
   EXPECT_EQ(reference_segment[1], column[1]);
   EXPECT_EQ(reference_segment[2], column[2]);
@@ -76,6 +78,7 @@ TEST_F(ReferenceSegmentTest, RetrievesValuesOutOfOrder) {
 
   auto& column = *(_test_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
 
+  PerformanceWarningDisabler pwd;
   EXPECT_EQ(reference_segment[0], column[1]);
   EXPECT_EQ(reference_segment[1], column[2]);
   EXPECT_EQ(reference_segment[2], column[0]);
@@ -90,6 +93,7 @@ TEST_F(ReferenceSegmentTest, RetrievesValuesFromChunks) {
   auto& column_1 = *(_test_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
   auto& column_2 = *(_test_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
 
+  PerformanceWarningDisabler pwd;
   EXPECT_EQ(reference_segment[0], column_1[2]);
   EXPECT_EQ(reference_segment[2], column_2[1]);
 }
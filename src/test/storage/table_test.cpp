@@ -71,6 +71,31 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, CreateEmptyChunks) {
+  t.create_empty_chunks(ChunkID{3});
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).column_count(), 0u);
+  EXPECT_EQ(t.column_count(), 2u);
+
+  auto table_with_rows = Table{2};
+  table_with_rows.add_column("col_1", "int");
+  table_with_rows.append({4});
+  EXPECT_THROW(table_with_rows.create_empty_chunks(ChunkID{1}), std::exception);
+}
+
+TEST_F(StorageTableTest, EstimateMemoryUsage) {
+  const auto empty_size = t.estimate_memory_usage();
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  const auto uncompressed_size = t.estimate_memory_usage();
+  EXPECT_GT(uncompressed_size, empty_size);
+
+  // the dictionary holds every value once, the attribute vector uses a single byte per row
+  t.compress_chunk(ChunkID{0});
+  EXPECT_GT(t.estimate_memory_usage(), empty_size);
+}
+
 TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_EQ(t.row_count(), 0u);
   t.append({4, "Hello,"});
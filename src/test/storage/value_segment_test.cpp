@@ -52,4 +52,21 @@ TEST_F(StorageValueSegmentTest, CheckData) {
   EXPECT_EQ(string_value_segment.values().at(0), "Hello");
 }
 
+TEST_F(StorageValueSegmentTest, EstimateMemoryUsage) {
+  const auto empty_size = string_value_segment.estimate_memory_usage();
+  EXPECT_EQ(empty_size, sizeof(ValueSegment<std::string>));
+
+  // short strings are stored within the vector, long ones need additional memory
+  string_value_segment.append("short");
+  const auto short_size = string_value_segment.estimate_memory_usage();
+  EXPECT_GE(short_size, empty_size + sizeof(std::string));
+  const auto long_value = std::string(1'000, 'x');
+  string_value_segment.append(long_value);
+  EXPECT_GE(string_value_segment.estimate_memory_usage(), short_size + sizeof(std::string) + long_value.size());
+
+  int_value_segment.append(1);
+  int_value_segment.append(2);
+  EXPECT_GE(int_value_segment.estimate_memory_usage(), sizeof(ValueSegment<int>) + 2 * sizeof(int));
+}
+
 }  // namespace opossum
@@ -0,0 +1,153 @@
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/abstract_operator.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "type_cast.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class TpchQueriesTest : public BaseTest {
+ protected:
+  void SetUp() override { TpchTableGenerator{0.01f, 5'000}.generate_and_store(); }
+
+  // returns the value of a cell of a table
+  template <typename T>
+  static T _value(const Table& table, const ColumnID column_id, const size_t row) {
+    PerformanceWarningDisabler pwd;
+    auto chunk_id = ChunkID{0};
+    auto chunk_offset = row;
+    while (chunk_offset >= table.get_chunk(chunk_id).size()) {
+      chunk_offset -= table.get_chunk(chunk_id).size();
+      ++chunk_id;
+    }
+    return type_cast<T>((*table.get_chunk(chunk_id).get_segment(column_id))[chunk_offset]);
+  }
+
+  // returns the number of rows that the scans of an executed plan output, each scan counted once
+  static uint64_t _scanned_row_count(const std::shared_ptr<const AbstractOperator>& root) {
+    auto row_count = uint64_t{0};
+    auto visited_operators = std::set<const AbstractOperator*>{};
+    auto pending_operators = std::vector<std::shared_ptr<const AbstractOperator>>{root};
+    while (!pending_operators.empty()) {
+      const auto op = pending_operators.back();
+      pending_operators.pop_back();
+      if (!op || !visited_operators.emplace(op.get()).second) continue;
+
+      if (op->name() == "TableScan" || op->name() == "MultiPredicateScan") row_count += op->get_output()->row_count();
+      pending_operators.emplace_back(op->input_left());
+      pending_operators.emplace_back(op->input_right());
+    }
+    return row_count;
+  }
+
+  static std::shared_ptr<const Table> _execute(const size_t query_id,
+                                               const ExecutionMode mode = ExecutionMode::OperatorAtATime) {
+    const auto plan = TpchQueries::build_plan(query_id);
+    Scheduler::execute(plan, mode);
+    return plan->get_output();
+  }
+};
+
+TEST_F(TpchQueriesTest, AllQueries) {
+  // the number of columns and the maximum number of rows of each query
+  const auto expected_shapes = std::vector<std::tuple<size_t, uint16_t, uint64_t>>{
+      {1, 10, 4}, {3, 4, 10}, {5, 2, 5}, {6, 1, 1}, {10, 8, 20}, {12, 3, 2}, {14, 1, 1}};
+  ASSERT_EQ(expected_shapes.size(), TpchQueries::query_ids().size());
+
+  for (const auto& [query_id, column_count, row_count] : expected_shapes) {
+    for (const auto mode : {ExecutionMode::OperatorAtATime, ExecutionMode::Pipelined}) {
+      const auto output = _execute(query_id, mode);
+      EXPECT_EQ(output->column_count(), column_count) << "query " << query_id;
+      EXPECT_GT(output->row_count(), 0u) << "query " << query_id;
+      EXPECT_LE(output->row_count(), row_count) << "query " << query_id;
+    }
+  }
+}
+
+TEST_F(TpchQueriesTest, Query1) {
+  const auto output = _execute(1);
+  ASSERT_EQ(output->row_count(), 4u);
+
+  // the groups are sorted by l_returnflag and l_linestatus
+  const auto expected_groups = std::vector<std::pair<std::string, std::string>>{
+      {"A", "F"}, {"N", "F"}, {"N", "O"}, {"R", "F"}};
+  auto count = int64_t{0};
+  for (auto row = size_t{0}; row < 4; ++row) {
+    EXPECT_EQ(_value<std::string>(*output, ColumnID{0}, row), expected_groups[row].first);
+    EXPECT_EQ(_value<std::string>(*output, ColumnID{1}, row), expected_groups[row].second);
+    count += _value<int64_t>(*output, ColumnID{9}, row);
+  }
+
+  // all lineitems shipped until 1998-09-02 are counted
+  const auto& lineitem = *StorageManager::get().get_table("lineitem");
+  const auto ship_date_column_id = lineitem.column_id_by_name("l_shipdate");
+  auto expected_count = int64_t{0};
+  for (auto row = size_t{0}; row < lineitem.row_count(); ++row) {
+    expected_count += _value<std::string>(lineitem, ship_date_column_id, row) <= "1998-09-02";
+  }
+  EXPECT_EQ(count, expected_count);
+}
+
+TEST_F(TpchQueriesTest, Query6) {
+  const auto output = _execute(6);
+  ASSERT_EQ(output->row_count(), 1u);
+
+  const auto& lineitem = *StorageManager::get().get_table("lineitem");
+  const auto ship_date_column_id = lineitem.column_id_by_name("l_shipdate");
+  const auto discount_column_id = lineitem.column_id_by_name("l_discount");
+  const auto quantity_column_id = lineitem.column_id_by_name("l_quantity");
+  const auto price_column_id = lineitem.column_id_by_name("l_extendedprice");
+  auto expected_revenue = 0.0;
+  for (auto row = size_t{0}; row < lineitem.row_count(); ++row) {
+    const auto ship_date = _value<std::string>(lineitem, ship_date_column_id, row);
+    const auto discount = _value<double>(lineitem, discount_column_id, row);
+    if (ship_date >= "1994-01-01" && ship_date < "1995-01-01" && discount >= 0.05 && discount <= 0.07 &&
+        _value<double>(lineitem, quantity_column_id, row) < 24.0) {
+      expected_revenue += _value<double>(lineitem, price_column_id, row) * discount;
+    }
+  }
+  EXPECT_GT(expected_revenue, 0.0);
+  EXPECT_NEAR(_value<double>(*output, ColumnID{0}, 0), expected_revenue, expected_revenue * 1e-9);
+}
+
+TEST_F(TpchQueriesTest, Query14) {
+  // the share of promotions among the part types is about 1/6
+  const auto promo_revenue = _value<double>(*_execute(14), ColumnID{0}, 0);
+  EXPECT_GT(promo_revenue, 10.0);
+  EXPECT_LT(promo_revenue, 25.0);
+}
+
+TEST_F(TpchQueriesTest, RuntimeFilters) {
+  for (const auto query_id : {3, 5, 10}) {
+    auto scanned_row_counts = std::vector<uint64_t>{};
+    auto outputs = std::vector<std::shared_ptr<const Table>>{};
+    for (const auto runtime_filters : {false, true}) {
+      const auto plan = TpchQueries::build_plan(query_id, runtime_filters);
+      // scans that are fused into pipelines have no output of their own
+      Scheduler::execute(plan, ExecutionMode::OperatorAtATime);
+      outputs.emplace_back(plan->get_output());
+      scanned_row_counts.emplace_back(_scanned_row_count(plan));
+    }
+
+    // fewer rows reach the joins, the result stays the same
+    EXPECT_LT(scanned_row_counts[1], scanned_row_counts[0]) << "query " << query_id;
+    EXPECT_TABLE_EQ(outputs[1], outputs[0], true);
+  }
+}
+
+TEST_F(TpchQueriesTest, UnsupportedQuery) { EXPECT_THROW(TpchQueries::build_plan(2), std::exception); }
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto tables = TpchTableGenerator{0.01f, 1'000}.generate();
+
+  ASSERT_EQ(tables.size(), 8u);
+  EXPECT_EQ(tables.at("region")->row_count(), 5u);
+  EXPECT_EQ(tables.at("nation")->row_count(), 25u);
+  EXPECT_EQ(tables.at("supplier")->row_count(), 100u);
+  EXPECT_EQ(tables.at("customer")->row_count(), 1'500u);
+  EXPECT_EQ(tables.at("part")->row_count(), 2'000u);
+  EXPECT_EQ(tables.at("partsupp")->row_count(), 8'000u);
+  EXPECT_EQ(tables.at("orders")->row_count(), 15'000u);
+
+  // one to seven lineitems per order, four on average
+  const auto lineitem_count = tables.at("lineitem")->row_count();
+  EXPECT_GT(lineitem_count, 55'000u);
+  EXPECT_LT(lineitem_count, 65'000u);
+  EXPECT_EQ(tables.at("lineitem")->column_count(), 16u);
+}
+
+TEST_F(TpchTableGeneratorTest, ChunkSize) {
+  const auto tables = TpchTableGenerator{0.01f, 1'000}.generate();
+
+  for (const auto& [name, table] : tables) {
+    EXPECT_EQ(table->chunk_size(), 1'000u) << name;
+    EXPECT_EQ(table->chunk_count(), (table->row_count() + 999) / 1'000) << name;
+    for (auto chunk_id = ChunkID{0}; chunk_id + 1 < table->chunk_count(); ++chunk_id) {
+      EXPECT_EQ(table->get_chunk(chunk_id).size(), 1'000u) << name;
+    }
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, Deterministic) {
+  const auto generator = TpchTableGenerator{0.001f, 500};
+  const auto first_tables = generator.generate();
+  const auto second_tables = generator.generate();
+
+  for (const auto& [name, table] : first_tables) {
+    EXPECT_TABLE_EQ(table, second_tables.at(name), true);
+  }
+
+  // the chunk size does not change the values
+  EXPECT_TABLE_EQ(first_tables.at("lineitem"), TpchTableGenerator{0.001f, 100}.generate().at("lineitem"), true);
+}
+
+TEST_F(TpchTableGeneratorTest, Dates) {
+  const auto [orders, lineitem] = TpchTableGenerator{0.01f, 10'000}.generate_orders_and_lineitem();  // NOLINT
+
+  const auto order_dates = _column_values<std::string>(*orders, "o_orderdate");
+  EXPECT_EQ(*std::min_element(order_dates.cbegin(), order_dates.cend()), "1992-01-01");
+  EXPECT_LE(*std::max_element(order_dates.cbegin(), order_dates.cend()), "1998-08-02");
+
+  const auto order_keys = _column_values<int32_t>(*lineitem, "l_orderkey");
+  const auto ship_dates = _column_values<std::string>(*lineitem, "l_shipdate");
+  const auto commit_dates = _column_values<std::string>(*lineitem, "l_commitdate");
+  const auto receipt_dates = _column_values<std::string>(*lineitem, "l_receiptdate");
+  const auto line_statuses = _column_values<std::string>(*lineitem, "l_linestatus");
+  for (auto row = size_t{0}; row < ship_dates.size(); ++row) {
+    const auto& order_date = order_dates[order_keys[row] - 1];
+    ASSERT_LT(order_date, ship_dates[row]);
+    ASSERT_LT(order_date, commit_dates[row]);
+    ASSERT_LT(ship_dates[row], receipt_dates[row]);
+    ASSERT_LE(receipt_dates[row], "1998-12-31");
+    ASSERT_EQ(line_statuses[row], ship_dates[row] > "1995-06-17" ? "O" : "F");
+  }
+
+  // every day in between is a valid date, e.g., there are lineitems shipped on the leap day of 1996
+  EXPECT_NE(std::find(ship_dates.cbegin(), ship_dates.cend(), "1996-02-29"), ship_dates.cend());
+  EXPECT_EQ(std::find(ship_dates.cbegin(), ship_dates.cend(), "1997-02-29"), ship_dates.cend());
+}
+
+TEST_F(TpchTableGeneratorTest, Keys) {
+  const auto tables = TpchTableGenerator{0.01f, 10'000}.generate();
+
+  // every lineitem is supplied by one of the suppliers of its part
+  auto part_suppliers = std::set<std::pair<int32_t, int32_t>>{};
+  const auto partsupp_part_keys = _column_values<int32_t>(*tables.at("partsupp"), "ps_partkey");
+  const auto partsupp_supplier_keys = _column_values<int32_t>(*tables.at("partsupp"), "ps_suppkey");
+  for (auto row = size_t{0}; row < partsupp_part_keys.size(); ++row) {
+    part_suppliers.emplace(partsupp_part_keys[row], partsupp_supplier_keys[row]);
+  }
+  EXPECT_EQ(part_suppliers.size(), partsupp_part_keys.size());
+
+  const auto part_keys = _column_values<int32_t>(*tables.at("lineitem"), "l_partkey");
+  const auto supplier_keys = _column_values<int32_t>(*tables.at("lineitem"), "l_suppkey");
+  for (auto row = size_t{0}; row < part_keys.size(); ++row) {
+    ASSERT_EQ(part_suppliers.count({part_keys[row], supplier_keys[row]}), 1u);
+  }
+
+  // a third of the customers has no orders
+  const auto customer_keys = _column_values<int32_t>(*tables.at("orders"), "o_custkey");
+  for (const auto customer_key : customer_keys) {
+    ASSERT_GE(customer_key, 1);
+    ASSERT_LE(customer_key, 1'500);
+    ASSERT_NE(customer_key % 3, 0);
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, GenerateAndStore) {
+  TpchTableGenerator{0.001f, 1'000}.generate_and_store();
+
+  const auto table_names = StorageManager::get().table_names();
+  EXPECT_EQ(std::set<std::string>(table_names.cbegin(), table_names.cend()),
+            std::set<std::string>({"region", "nation", "supplier", "customer", "part", "partsupp", "orders",
+                                   "lineitem"}));
+  EXPECT_EQ(StorageManager::get().get_table("supplier")->row_count(), 10u);
+}
+
+}  // namespace opossum
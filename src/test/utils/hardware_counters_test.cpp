@@ -0,0 +1,77 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class HardwareCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { HardwareCounters::disable(); }
+};
+
+TEST_F(HardwareCountersTest, Summary) {
+  const auto values = HardwareCounterValues{2'000, 3'000, 50, std::nullopt};
+  EXPECT_DOUBLE_EQ(*values.instructions_per_cycle(), 1.5);
+  EXPECT_EQ(values.to_string(100), "IPC 1.50, 0.500 LLC misses/row");
+
+  const auto without_instructions = HardwareCounterValues{2'000, std::nullopt, std::nullopt, 7};
+  EXPECT_FALSE(without_instructions.instructions_per_cycle());
+  EXPECT_EQ(without_instructions.to_string(0), "2000 cycles, 7 branch misses");
+
+  EXPECT_EQ(HardwareCounterValues{}.to_string(100), "");
+}
+
+TEST_F(HardwareCountersTest, Readings) {
+  // only the counters that could be opened for the thread are available
+  auto readings = HardwareCounterReadings{};
+  readings.counts = {2'000, 3'000, 0, 7};
+  readings.available_counters = (1u << HardwareCounters::Cycles) | (1u << HardwareCounters::Instructions);
+  const auto values = HardwareCounterValues::from_readings(readings);
+  EXPECT_EQ(values.cycles, 2'000u);
+  EXPECT_EQ(values.instructions, 3'000u);
+  EXPECT_FALSE(values.last_level_cache_misses);
+  EXPECT_FALSE(values.branch_misses);
+}
+
+TEST_F(HardwareCountersTest, Sum) {
+  auto values = HardwareCounterValues{2'000, 3'000, 50, std::nullopt};
+  values += HardwareCounterValues{1'000, std::nullopt, 10, 5};
+  EXPECT_EQ(values.cycles, 3'000u);
+  EXPECT_FALSE(values.instructions);
+  EXPECT_EQ(values.last_level_cache_misses, 60u);
+  EXPECT_FALSE(values.branch_misses);
+}
+
+TEST_F(HardwareCountersTest, OperatorCounters) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 1'000; ++row) table->append({(row * 7919) % 1'000});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // the counters may not be permitted, e.g., in containers, in which case they are missing
+  const auto available = HardwareCounters::enable();
+  EXPECT_EQ(HardwareCounters::is_enabled(), available);
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+  sort->execute();
+  const auto& counters = sort->performance_data().hardware_counters;
+  EXPECT_EQ(counters.cycles.has_value(), available && HardwareCounters::is_available(HardwareCounters::Cycles));
+  EXPECT_EQ(counters.instructions.has_value(),
+            available && HardwareCounters::is_available(HardwareCounters::Instructions));
+  if (counters.instructions) EXPECT_GT(*counters.instructions, 1'000u);
+
+  HardwareCounters::disable();
+  auto second_sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+  second_sort->execute();
+  EXPECT_FALSE(second_sort->performance_data().hardware_counters.cycles);
+  EXPECT_FALSE(second_sort->performance_data().hardware_counters.instructions);
+}
+
+}  // namespace opossum
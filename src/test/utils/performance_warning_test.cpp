@@ -0,0 +1,134 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+// the tests run in strict mode (see gtest_main.cpp), which these tests only enable where they check it
+class PerformanceWarningTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previously_strict = PerformanceWarnings::is_strict();
+    PerformanceWarnings::set_strict(false);
+    PerformanceWarnings::reset();
+
+    _segment = std::make_shared<ValueSegment<int32_t>>();
+    _segment->append(1);
+    _segment->append(2);
+  }
+
+  void TearDown() override {
+    PerformanceWarnings::set_strict(_previously_strict);
+    PerformanceWarnings::reset();
+  }
+
+  bool _previously_strict;
+  std::shared_ptr<ValueSegment<int32_t>> _segment;
+};
+
+TEST_F(PerformanceWarningTest, CountsHits) {
+  EXPECT_EQ(PerformanceWarnings::count("ValueSegment::operator[]"), 0u);
+  (*_segment)[0];
+  (*_segment)[1];
+  EXPECT_EQ(PerformanceWarnings::count("ValueSegment::operator[]"), 2u);
+  EXPECT_EQ(PerformanceWarnings::counts(), (PerformanceWarningCounts{{"ValueSegment::operator[]", 2}}));
+
+  PerformanceWarnings::reset();
+  EXPECT_EQ(PerformanceWarnings::count("ValueSegment::operator[]"), 0u);
+  EXPECT_TRUE(PerformanceWarnings::counts().empty());
+}
+
+TEST_F(PerformanceWarningTest, CountsNestedSlowPaths) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  table->append({1});
+  table->append({2});
+  const auto positions = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 1}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, positions};
+
+  EXPECT_EQ(type_cast<int32_t>(reference_segment[0]), 2);
+  EXPECT_EQ(PerformanceWarnings::counts(),
+            (PerformanceWarningCounts{{"ReferenceSegment::operator[]", 1}, {"ValueSegment::operator[]", 1}}));
+}
+
+TEST_F(PerformanceWarningTest, SumsThreads) {
+  (*_segment)[0];
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 4; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto hit = 0; hit < 100; ++hit) (*_segment)[0];
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // the counts of exited threads are kept
+  EXPECT_EQ(PerformanceWarnings::count("ValueSegment::operator[]"), 401u);
+}
+
+TEST_F(PerformanceWarningTest, Disabler) {
+  {
+    PerformanceWarningDisabler pwd;
+    EXPECT_FALSE(PerformanceWarnings::is_enabled());
+    (*_segment)[0];
+  }
+  EXPECT_TRUE(PerformanceWarnings::is_enabled());
+  EXPECT_EQ(PerformanceWarnings::count("ValueSegment::operator[]"), 0u);
+}
+
+TEST_F(PerformanceWarningTest, DisablerOnlyAffectsCallingThread) {
+  PerformanceWarningDisabler pwd;
+  auto thread = std::thread{[&]() {
+    EXPECT_TRUE(PerformanceWarnings::is_enabled());
+    (*_segment)[0];
+
+    // overlapping disablers of different threads restore their own state
+    {
+      PerformanceWarningDisabler other_pwd;
+      EXPECT_FALSE(PerformanceWarnings::is_enabled());
+    }
+    EXPECT_TRUE(PerformanceWarnings::is_enabled());
+  }};
+  thread.join();
+
+  EXPECT_FALSE(PerformanceWarnings::is_enabled());
+  EXPECT_EQ(PerformanceWarnings::count("ValueSegment::operator[]"), 1u);
+}
+
+TEST_F(PerformanceWarningTest, StrictMode) {
+  PerformanceWarnings::set_strict(true);
+  EXPECT_THROW((*_segment)[0], std::logic_error);
+
+  PerformanceWarningDisabler pwd;
+  EXPECT_NO_THROW((*_segment)[0]);
+}
+
+TEST_F(PerformanceWarningTest, CountsSince) {
+  (*_segment)[0];
+  const auto previous_counts = PerformanceWarnings::counts();
+  EXPECT_TRUE(PerformanceWarnings::counts_since(previous_counts).empty());
+
+  (*_segment)[0];
+  (*_segment)[1];
+  EXPECT_EQ(PerformanceWarnings::counts_since(previous_counts),
+            (PerformanceWarningCounts{{"ValueSegment::operator[]", 2}}));
+}
+
+TEST_F(PerformanceWarningTest, Print) {
+  auto stream = std::stringstream{};
+  PerformanceWarnings::print({{"a", 1}, {"b", 42}}, stream);
+  EXPECT_EQ(stream.str(), "a: 1\nb: 42\n");
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/plan_printer.hpp"
+
+namespace opossum {
+
+class PlanPrinterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    for (auto row = 0; row < 20; ++row) table->append({row});
+
+    // the wrapper is the input of both the scan and the join
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+    _join = std::make_shared<JoinHash>(_scan, _table_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                       ScanType::OpEquals);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableScan> _scan;
+  std::shared_ptr<JoinHash> _join;
+};
+
+TEST_F(PlanPrinterTest, PrintsTree) {
+  auto stream = std::stringstream{};
+  PlanPrinter::print(*_join, stream);
+  EXPECT_EQ(stream.str(),
+            "[0] JoinHash: not executed\n"
+            "+- [1] TableScan: not executed\n"
+            "|  +- [2] TableWrapper: not executed\n"
+            "+- [2] TableWrapper (see above)\n");
+
+  _table_wrapper->execute();
+  _scan->execute();
+  _join->execute();
+  stream.str("");
+  PlanPrinter::print(*_join, stream);
+  const auto output = stream.str();
+  EXPECT_NE(output.find("[1] TableScan: "), std::string::npos);
+  EXPECT_NE(output.find("20 -> 5 rows, 2 -> 1 chunks"), std::string::npos);
+  EXPECT_NE(output.find("25 -> 5 rows"), std::string::npos);
+}
+
+TEST_F(PlanPrinterTest, PrintsDot) {
+  auto stream = std::stringstream{};
+  PlanPrinter::print_dot(*_join, stream);
+  EXPECT_EQ(stream.str(),
+            "digraph {\n"
+            "  node [shape=box, fontname=\"monospace\"];\n"
+            "  operator0 [label=\"[0] JoinHash\\nnot executed\"];\n"
+            "  operator1 [label=\"[1] TableScan\\nnot executed\"];\n"
+            "  operator2 [label=\"[2] TableWrapper\\nnot executed\"];\n"
+            "  operator2 -> operator1;\n"
+            "  operator1 -> operator0;\n"
+            "  operator2 -> operator0;\n"
+            "}\n");
+}
+
+}  // namespace opossum
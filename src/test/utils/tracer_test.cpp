@@ -0,0 +1,94 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+class TracerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_worker_count = WorkerPool::get().worker_count();
+    Tracer::clear();
+  }
+
+  void TearDown() override {
+    Tracer::disable();
+    Tracer::clear();
+    WorkerPool::get().set_worker_count(_previous_worker_count);
+  }
+
+  static std::string _trace() {
+    auto stream = std::stringstream{};
+    Tracer::write_chrome_trace(stream);
+    return stream.str();
+  }
+
+  static size_t _count(const std::string& string, const std::string& pattern) {
+    auto count = size_t{0};
+    auto position = string.find(pattern);
+    while (position != std::string::npos) {
+      ++count;
+      position = string.find(pattern, position + 1);
+    }
+    return count;
+  }
+
+  size_t _previous_worker_count;
+};
+
+TEST_F(TracerTest, RecordsNothingWhenDisabled) {
+  { const auto trace_scope = Tracer::Scope{"test", "disabled"}; }
+  EXPECT_EQ(_count(_trace(), "\"ph\": \"X\""), 0u);
+}
+
+TEST_F(TracerTest, RecordsOperatorsAndChunks) {
+  WorkerPool::get().set_worker_count(2);
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 50; ++row) table->append({row});
+
+  Tracer::enable();
+  table->compress_chunk(ChunkID{1});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 25);
+  scan->execute();
+  Tracer::disable();
+
+  const auto trace = _trace();
+  EXPECT_EQ(trace.find("{\"displayTimeUnit\": \"ns\", \"traceEvents\": ["), 0u);
+  EXPECT_EQ(_count(trace, "\"name\": \"TableWrapper\""), 1u);
+  EXPECT_EQ(_count(trace, "\"name\": \"TableScan\""), 1u);
+  EXPECT_EQ(_count(trace, "\"name\": \"scan_chunk\""), 5u);
+  EXPECT_EQ(_count(trace, "\"name\": \"compress_chunk\", \"ts\": "), 1u);
+  EXPECT_NE(trace.find("\"args\": {\"chunk_id\": 4}"), std::string::npos);
+  EXPECT_NE(trace.find("\"args\": {\"name\": \"worker 0\"}"), std::string::npos);
+
+  Tracer::clear();
+  EXPECT_EQ(_count(_trace(), "\"ph\": \"X\""), 0u);
+}
+
+TEST_F(TracerTest, KeepsNewestEvents) {
+  Tracer::enable();
+  const auto event_count = Tracer::EVENTS_PER_THREAD + 10;
+  for (auto index = size_t{0}; index < event_count; ++index) {
+    Tracer::record("test", "event", index, index + 1, "index", index);
+  }
+
+  const auto trace = _trace();
+  EXPECT_EQ(_count(trace, "\"ph\": \"X\""), Tracer::EVENTS_PER_THREAD);
+  EXPECT_EQ(trace.find("\"args\": {\"index\": 9}"), std::string::npos);
+  EXPECT_NE(trace.find("\"args\": {\"index\": 10}"), std::string::npos);
+  EXPECT_NE(trace.find("\"ts\": 0.010, \"dur\": 0.001"), std::string::npos);
+}
+
+}  // namespace opossum